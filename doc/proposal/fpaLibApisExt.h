@@ -0,0 +1,2519 @@
+/*
+ *  Copyright (C) 2016. Marvell International Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+/*
+********************************************************************************
+* fpaLibApisExt.h
+*
+* DESCRIPTION:
+*       OpenFlow FPA Library extension APIs.
+*       Design proposal, not implemented: the released libfpa (mrvllibfpa
+*       1.0.1) exports none of these functions. See README.md.
+*
+* FILE REVISION NUMBER:
+*       $Revision: 01 $
+*
+*******************************************************************************/
+#ifndef __INCLUDE_FPA_API_EXT_H
+#define __INCLUDE_FPA_API_EXT_H
+
+#ifndef FPA_LIB_EXT_APIS
+#error "fpaLibApisExt.h is a design proposal, not implemented by libfpa"
+#endif /* FPA_LIB_EXT_APIS */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+
+#include "fpaLibApis.h"
+#include "fpaLibTypesExt.h"
+
+/******************************************************************************* 
+                            Flow Table APIs
+*******************************************************************************/
+
+/*******************************************************************************
+* fpaLibFlowEntryAddBatch
+*
+* DESCRIPTION:
+*       Add array of new flow entries to flow table.
+*       Used to support execution of a burst of OFPFC_ADD OF protocol messages.
+*
+* INPUTS:
+*       switchId           - The logical OpenFlow switch number.
+*       flowTableNo        - Flow Table number in OpenFlow pipeline
+*       flowEntryArraySize - number of entries in flowEntryArray
+*       flowEntryArray     - array of flow entries
+*
+* OUTPUTS:
+*       statusArray        - per entry status, same size as flowEntryArray
+*       numOfDonePtr       - number of entries added successfully
+*
+* RETURNS:
+*       FPA_OK                    - all the entries were added.
+*       FPA_FAIL                  - part of the entries were not added,
+*                                   see statusArray
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       Each entry is handled as by fpaLibFlowEntryAdd, and statusArray[i]
+*       holds the code fpaLibFlowEntryAdd would return for flowEntryArray[i].
+*       The table is locked once for the whole array, all entries are validated
+*       before any hardware access, and the hardware writes are coalesced per
+*       table. A failed entry does not stop the processing of the next ones.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowEntryAddBatch
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       flowTableNo,
+    IN   uint32_t                       flowEntryArraySize,
+    IN   FPA_FLOW_TABLE_ENTRY_STC       *flowEntryArray,
+    OUT  FPA_STATUS                     *statusArray,
+    OUT  uint32_t                       *numOfDonePtr
+);
+
+/*******************************************************************************
+* fpaLibFlowEntryModifyBatch
+*
+* DESCRIPTION:
+*       Modify array of flow entries.
+*       Used to support execution of a burst of OFPFC_MODIFY and
+*       OFPFC_MODIFY_STRICT OF protocol messages.
+*
+* INPUTS:
+*       switchId           - The logical OpenFlow switch number.
+*       flowTableNo        - Flow Table number in OpenFlow pipeline
+*       flowEntryArraySize - number of entries in flowEntryArray
+*       flowEntryArray     - array of request flow entries
+*       matchingMode       - 0: match entry strictly wildcards and priority.
+*                            1: non-strict mode, modify all matching flows
+*
+* OUTPUTS:
+*       statusArray        - per entry status, same size as flowEntryArray
+*       numOfDonePtr       - number of entries modified successfully
+*
+* RETURNS:
+*       FPA_OK                    - all the entries were modified.
+*       FPA_FAIL                  - part of the entries were not modified,
+*                                   see statusArray
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       Each entry is handled as by fpaLibFlowEntryModify, see
+*       fpaLibFlowEntryAddBatch for the locking and the status reporting.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowEntryModifyBatch
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       flowTableNo,
+    IN   uint32_t                       flowEntryArraySize,
+    IN   FPA_FLOW_TABLE_ENTRY_STC       *flowEntryArray,
+    IN   uint32_t                       matchingMode,
+    OUT  FPA_STATUS                     *statusArray,
+    OUT  uint32_t                       *numOfDonePtr
+);
+
+/*******************************************************************************
+* fpaLibFlowEntryDeleteBatch
+*
+* DESCRIPTION:
+*       Delete array of flow entries.
+*       Used to support execution of a burst of OFPFC_DELETE and
+*       OFPFC_DELETE_STRICT OF protocol messages.
+*
+* INPUTS:
+*       switchId           - The logical OpenFlow switch number.
+*       flowTableNo        - Flow Table number in OpenFlow pipeline
+*       flowEntryArraySize - number of entries in flowEntryArray
+*       flowEntryArray     - array of request flow entries
+*       matchingMode       - 0: delete entry strictly wildcards and priority.
+*                            1: non-strict mode, delete all matching flows
+*
+* OUTPUTS:
+*       statusArray        - per entry status, same size as flowEntryArray
+*       numOfDonePtr       - number of entries deleted successfully
+*
+* RETURNS:
+*       FPA_OK                    - all the entries were deleted.
+*       FPA_FAIL                  - part of the entries were not deleted,
+*                                   see statusArray
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       Each entry is handled as by fpaLibFlowEntryDelete, see
+*       fpaLibFlowEntryAddBatch for the locking and the status reporting.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowEntryDeleteBatch
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       flowTableNo,
+    IN   uint32_t                       flowEntryArraySize,
+    IN   FPA_FLOW_TABLE_ENTRY_STC       *flowEntryArray,
+    IN   uint32_t                       matchingMode,
+    OUT  FPA_STATUS                     *statusArray,
+    OUT  uint32_t                       *numOfDonePtr
+);
+
+/*******************************************************************************
+* fpaLibFlowTransactionBegin
+*
+* DESCRIPTION:
+*       Open a flow transaction.
+*       Used to support execution of OFPBCT_OPEN_REQUEST OF bundle messages.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       transactionId - transaction identifier chosen by the caller
+*       flags         - FPA_FLOW_TRANSACTION_ORDERED_FLAG or 0
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_ALREADY_EXIST         - transaction with this identifier is open
+*       FPA_NO_RESOURCE           - too many open transactions
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       Operations staged into the transaction are not visible in the tables
+*       until fpaLibFlowTransactionCommit. A transaction may span several
+*       flow tables. Without FPA_FLOW_TRANSACTION_ORDERED_FLAG the library may
+*       reorder and coalesce the staged operations.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTransactionBegin
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       transactionId,
+    IN   uint32_t                       flags
+);
+
+/*******************************************************************************
+* fpaLibFlowTransactionEntryAdd
+*
+* DESCRIPTION:
+*       Stage adding of flow entry to flow table in an open transaction.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       transactionId - transaction identifier
+*       flowTableNo   - Flow Table number in OpenFlow pipeline
+*       flowEntryPtr  - pointer to a flow entry
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - transaction is not open
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       The entry is validated and copied when staged, the caller may reuse
+*       flowEntryPtr right after the call. On commit the entry is handled as
+*       by fpaLibFlowEntryAdd.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTransactionEntryAdd
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       transactionId,
+    IN   uint32_t                       flowTableNo,
+    IN   FPA_FLOW_TABLE_ENTRY_STC       *flowEntryPtr
+);
+
+/*******************************************************************************
+* fpaLibFlowTransactionEntryModify
+*
+* DESCRIPTION:
+*       Stage modification of flow entries in an open transaction.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       transactionId - transaction identifier
+*       flowTableNo   - Flow Table number in OpenFlow pipeline
+*       flowEntryPtr  - pointer to a request flow entry
+*       matchingMode  - 0: match entry strictly wildcards and priority.
+*                       1: non-strict mode, modify all matching flows
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - transaction is not open
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       On commit the entry is handled as by fpaLibFlowEntryModify.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTransactionEntryModify
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       transactionId,
+    IN   uint32_t                       flowTableNo,
+    IN   FPA_FLOW_TABLE_ENTRY_STC       *flowEntryPtr,
+    IN   uint32_t                       matchingMode
+);
+
+/*******************************************************************************
+* fpaLibFlowTransactionEntryDelete
+*
+* DESCRIPTION:
+*       Stage deletion of flow entries in an open transaction.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       transactionId - transaction identifier
+*       flowTableNo   - Flow Table number in OpenFlow pipeline
+*       flowEntryPtr  - pointer to request flow entry
+*       matchingMode  - 0: delete entry strictly wildcards and priority.
+*                       1: non-strict mode, delete all matching flows
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - transaction is not open
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       On commit the entry is handled as by fpaLibFlowEntryDelete.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTransactionEntryDelete
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       transactionId,
+    IN   uint32_t                       flowTableNo,
+    IN   FPA_FLOW_TABLE_ENTRY_STC       *flowEntryPtr,
+    IN   uint32_t                       matchingMode
+);
+
+/*******************************************************************************
+* fpaLibFlowTransactionCommit
+*
+* DESCRIPTION:
+*       Apply all the operations staged in the transaction and close it.
+*       Used to support execution of OFPBCT_COMMIT_REQUEST OF bundle messages.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       transactionId - transaction identifier
+*
+* OUTPUTS:
+*       failedOpIndexPtr - index (in staging order) of the operation that
+*                          failed, valid only if commit failed
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - transaction is not open
+*       FPA_NO_RESOURCE           - no room in TCAM/FDB for the staged entries
+*       FPA_FAIL                  - operation failed, all tables restored
+*
+* COMMENTS:
+*       TCAM and FDB resources for all the staged entries are reserved before
+*       the first hardware write, so lack of space is detected with no table
+*       modified. If an operation fails during apply, the already applied
+*       operations are rolled back and the tables are left as they were
+*       before the commit. The transaction is closed in any case.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTransactionCommit
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       transactionId,
+    OUT  uint32_t                       *failedOpIndexPtr
+);
+
+/*******************************************************************************
+* fpaLibFlowTransactionAbort
+*
+* DESCRIPTION:
+*       Discard all the operations staged in the transaction and close it.
+*       Used to support execution of OFPBCT_DISCARD_REQUEST OF bundle messages.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       transactionId - transaction identifier
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - transaction is not open
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTransactionAbort
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       transactionId
+);
+
+/*******************************************************************************
+* fpaLibFlowTableCookieMaskDelete
+*
+* DESCRIPTION:
+*       Delete from the flow table all the entries with cookie matching the
+*       given cookie and mask.
+*       Used to support OFPFC_DELETE with cookie_mask.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       flowTableNo   - Flow Table number in OpenFlow pipeline or
+*                       FPA_FLOW_TABLE_ALL for all the tables of the switch
+*       cookie        - given cookie
+*       cookieMask    - bits of the cookie to compare, 0 matches all entries
+*
+* OUTPUTS:
+*       numOfDeletedPtr - number of deleted entries
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       An entry is deleted if (entry cookie & cookieMask) == (cookie & cookieMask).
+*       With full mask the call costs as fpaLibFlowTableCookieDelete. If no
+*       flow entry matches, no error is recorded.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTableCookieMaskDelete
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       flowTableNo,
+    IN   uint64_t                       cookie,
+    IN   uint64_t                       cookieMask,
+    OUT  uint32_t                       *numOfDeletedPtr
+);
+
+/*******************************************************************************
+* fpaLibFlowTableLpmLookup
+*
+* DESCRIPTION:
+*       Retrives the L3 unicast route entry with longest prefix matching
+*       a given address.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       flowTableNo   - Flow Table number of L3 unicast IPv4 or IPv6 table
+*       flowEntryPtr  - pointer to flow entry with match.vrfId and match.dstIp4
+*                       or match.dstIp6 written
+*
+* OUTPUTS:
+*       flowEntryPtr  - flow entry will be filled by the matching route content
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - no route matches the address
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       The library keeps one route trie per address family mirroring the
+*       installed routes of all the VRFs. The VRF id is the leading part of the
+*       trie key, so the trie memory grows with the number of routes and not
+*       with the number of VRFs. The trie is updated by the flow
+*       add/modify/delete calls and answers without device access.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTableLpmLookup
+(
+    IN    uint32_t                       switchId,
+    IN    uint32_t                       flowTableNo,
+    INOUT FPA_FLOW_TABLE_ENTRY_STC       *flowEntryPtr
+);
+
+/*******************************************************************************
+* fpaLibFlowTableLpmOverlapGet
+*
+* DESCRIPTION:
+*       Check the overlap of a route prefix with the installed routes.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       flowTableNo   - Flow Table number of L3 unicast IPv4 or IPv6 table
+*       flowEntryPtr  - pointer to flow entry with match.vrfId and the
+*                       destination prefix (address and mask) written
+*
+* OUTPUTS:
+*       overlapPtr    - (pointer to) overlap information
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       The mask must be a prefix mask.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTableLpmOverlapGet
+(
+    IN    uint32_t                       switchId,
+    IN    uint32_t                       flowTableNo,
+    IN    FPA_FLOW_TABLE_ENTRY_STC       *flowEntryPtr,
+    OUT   FPA_FLOW_TABLE_LPM_OVERLAP_STC *overlapPtr
+);
+
+/*******************************************************************************
+* fpaLibFlowTableLpmStatisticsGet
+*
+* DESCRIPTION:
+*       Retrives the library route trie statistics.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*
+* OUTPUTS:
+*       countersPtr   - (pointer to) route trie counters
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTableLpmStatisticsGet
+(
+    IN    uint32_t                        switchId,
+    OUT   FPA_FLOW_TABLE_LPM_COUNTERS_STC *countersPtr
+);
+
+/*******************************************************************************
+* fpaLibFlowTableRouteSync
+*
+* DESCRIPTION:
+*       Bring the installed routes of a VRF to a desired route set, applying
+*       only the difference.
+*
+* INPUTS:
+*       switchId       - The logical OpenFlow switch number.
+*       flowTableNo    - Flow Table number of L3 unicast IPv4 or IPv6 table
+*       vrfId          - VRF-ID of the routes
+*       mode           - full or partial route set
+*       routeArraySize - number of routes in routeArray
+*       routeArray     - the route set
+*
+* OUTPUTS:
+*       resultPtr      - (pointer to) synchronization result
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_FAIL                  - part of the routes were not applied,
+*                                   numOfFailed or numOfFailedDeletes of
+*                                   resultPtr is not 0
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       The set is compared with the installed routes using the library route
+*       trie, and the resulting add, modify and delete operations are applied
+*       in batches. To avoid traffic blackholing, adds and modifies are applied
+*       before deletes, covering prefixes are added before more specific ones,
+*       and more specific prefixes are deleted before their covering ones.
+*       All the routes must have match.vrfId equal to vrfId.
+*       A failed operation does not stop the synchronization. In full mode the
+*       installed routes missing from the set are deleted by the library, so
+*       their failures are reported by numOfFailedDeletes and
+*       firstFailedDelete, which holds the route prefix, and not by
+*       firstFailedIndex.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTableRouteSync
+(
+    IN    uint32_t                              switchId,
+    IN    uint32_t                              flowTableNo,
+    IN    uint16_t                              vrfId,
+    IN    FPA_FLOW_TABLE_ROUTE_SYNC_MODE_ENT    mode,
+    IN    uint32_t                              routeArraySize,
+    IN    FPA_FLOW_TABLE_ROUTE_SYNC_ENTRY_STC   *routeArray,
+    OUT   FPA_FLOW_TABLE_ROUTE_SYNC_RESULT_STC  *resultPtr
+);
+
+/*******************************************************************************
+* fpaLibFlowTableCursorOpen
+*
+* DESCRIPTION:
+*       Open a cursor on a snapshot of the flow table.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       flowTableNo   - Flow Table number in OpenFlow pipeline
+*       fieldsBmp     - bitmap of FPA_FLOW_TABLE_CURSOR_*_FLAG, the entry
+*                       fields to copy on fetch
+*
+* OUTPUTS:
+*       cursorIdPtr   - identifier of the opened cursor
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NO_RESOURCE           - too many open cursors
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       The cursor records the table epoch at open time. Fetch returns the
+*       entries as they were at that epoch in a stable order: entries added
+*       later are not returned, and entries modified or deleted later are
+*       returned with their content at open time.
+*       Cursors are independent, several threads may walk the same or
+*       different tables concurrently, each with its own cursor.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTableCursorOpen
+(
+    IN    uint32_t                       switchId,
+    IN    uint32_t                       flowTableNo,
+    IN    uint32_t                       fieldsBmp,
+    OUT   uint32_t                       *cursorIdPtr
+);
+
+/*******************************************************************************
+* fpaLibFlowTableCursorFetch
+*
+* DESCRIPTION:
+*       Retrives the next flow table entries of a cursor.
+*
+* INPUTS:
+*       switchId        - The logical OpenFlow switch number.
+*       cursorId        - cursor identifier
+*       entryArraySize  - number of entries in flowEntryArray
+*
+* OUTPUTS:
+*       flowEntryArray  - filled by flow table entries content
+*       numOfEntriesPtr - number of entries filled
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NO_MORE               - end of the table, no entry filled
+*       FPA_NOT_FOUND             - cursor is not open
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       Only the fields selected by fieldsBmp on open are written, the rest
+*       of every entry is left untouched.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTableCursorFetch
+(
+    IN    uint32_t                       switchId,
+    IN    uint32_t                       cursorId,
+    IN    uint32_t                       entryArraySize,
+    OUT   FPA_FLOW_TABLE_ENTRY_STC       *flowEntryArray,
+    OUT   uint32_t                       *numOfEntriesPtr
+);
+
+/*******************************************************************************
+* fpaLibFlowTableCursorClose
+*
+* DESCRIPTION:
+*       Close a cursor and release its snapshot.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       cursorId      - cursor identifier
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - cursor is not open
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTableCursorClose
+(
+    IN    uint32_t                       switchId,
+    IN    uint32_t                       cursorId
+);
+
+/*******************************************************************************
+* fpaLibFlowTableStatisticsBulkGet
+*
+* DESCRIPTION:
+*       Retrives the per flow entry statistics of all the table entries, or of
+*       the entries with matching cookie.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number.
+*       flowTableNo   - Flow Table number in OpenFlow pipeline
+*       cookie        - given cookie
+*       cookieMask    - bits of the cookie to compare, 0 for all the entries
+*       bulkPtr       - arrays to fill and resume position
+*
+* OUTPUTS:
+*       bulkPtr       - filled by the entries statistics
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - cursorId of a resumed call is not open
+*       FPA_NO_RESOURCE           - too many open cursors
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       An entry is reported if (entry cookie & cookieMask) == (cookie & cookieMask).
+*       The counters of all the reported entries are read from the device in
+*       blocks rather than entry by entry. If the arrays are too small, call
+*       again with the returned resumeIndex and cursorId until resumeIndex is
+*       0. The call with resumeIndex 0 takes a snapshot of the table entries
+*       by a cursor, so paging is consistent under concurrent flow changes:
+*       every entry installed at that time is reported once, entries added
+*       later are not reported, and entries deleted later are reported with
+*       their counters at delete time. Counters are read when their page is
+*       returned.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTableStatisticsBulkGet
+(
+    IN    uint32_t                            switchId,
+    IN    uint32_t                            flowTableNo,
+    IN    uint64_t                            cookie,
+    IN    uint64_t                            cookieMask,
+    INOUT FPA_FLOW_TABLE_STATISTICS_BULK_STC  *bulkPtr
+);
+
+/*******************************************************************************
+* fpaLibFlowTableStatisticsChangedGet
+*
+* DESCRIPTION:
+*       Retrives the per flow entry statistics of the table entries whose
+*       counters changed since a given statistics generation.
+*
+* INPUTS:
+*       switchId        - The logical OpenFlow switch number.
+*       flowTableNo     - Flow Table number in OpenFlow pipeline
+*       sinceGeneration - generation returned by the previous query,
+*                         0 for all the entries
+*       bulkPtr         - arrays to fill and resume position
+*
+* OUTPUTS:
+*       bulkPtr         - filled by the changed entries statistics
+*       generationPtr   - statistics generation of the query, to pass as
+*                         sinceGeneration on the next query
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - cursorId of a resumed call is not open
+*       FPA_NO_RESOURCE           - too many open cursors
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       The library advances the switch statistics generation on every pass
+*       that reads the counter blocks from the device, and keeps per entry
+*       the generation of the last pass in which its packet or byte count
+*       moved. Entries changed after sinceGeneration are reported, with
+*       absolute values. Collectors polling with different sinceGeneration
+*       values do not affect each other, and a missed poll only makes the
+*       next one report more entries.
+*       When the harvester is enabled its passes advance the generation, see
+*       fpaLibStatisticsHarvesterSet. When it is disabled (default), a call
+*       with resumeIndex 0 first reads the queried counters from the device
+*       in one pass, which advances the generation.
+*       If the arrays are too small, call again with the returned resumeIndex
+*       and cursorId and the same sinceGeneration until resumeIndex is 0. The
+*       pages are taken from one snapshot, as in
+*       fpaLibFlowTableStatisticsBulkGet. generationPtr
+*       is the generation taken by the call with resumeIndex 0 and is
+*       returned unchanged by the resumed calls, so entries of earlier pages
+*       that change meanwhile are reported by the next query.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibFlowTableStatisticsChangedGet
+(
+    IN    uint32_t                            switchId,
+    IN    uint32_t                            flowTableNo,
+    IN    uint64_t                            sinceGeneration,
+    INOUT FPA_FLOW_TABLE_STATISTICS_BULK_STC  *bulkPtr,
+    OUT   uint64_t                            *generationPtr
+);
+
+
+/******************************************************************************* 
+                            Group Table APIs
+*******************************************************************************/
+
+/*******************************************************************************
+* fpaLibGroupStatisticsChangedGet
+*
+* DESCRIPTION:
+*       Retrives the statistics of the groups whose counters changed since a
+*       given statistics generation.
+*
+* INPUTS:
+*       switchId        - The logical OpenFlow switch number.
+*       sinceGeneration - generation returned by the previous query,
+*                         0 for all the groups
+*       resumeIndexPtr  - 0 to start from the first group
+*       entryArraySize  - number of entries in entryArray
+*
+* OUTPUTS:
+*       resumeIndexPtr  - position to continue from, 0 if no more groups
+*       entryArray      - filled by the changed groups statistics
+*       numOfEntriesPtr - number of entries filled
+*       generationPtr   - statistics generation of the query
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       See fpaLibFlowTableStatisticsChangedGet, except that the pages are
+*       not taken from a snapshot: resumeIndex is a position in the group
+*       table, so a group added or deleted between two calls of the same query
+*       can shift it, and another group can be skipped or reported twice.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupStatisticsChangedGet
+(
+    IN    uint32_t                        switchId,
+    IN    uint64_t                        sinceGeneration,
+    INOUT uint32_t                        *resumeIndexPtr,
+    IN    uint32_t                        entryArraySize,
+    OUT   FPA_GROUP_STATISTICS_ENTRY_STC  *entryArray,
+    OUT   uint32_t                        *numOfEntriesPtr,
+    OUT   uint64_t                        *generationPtr
+);
+
+/*******************************************************************************
+* fpaLibGroupEntryBucketSet
+*
+* DESCRIPTION:
+*       Replace all the buckets of a group by a given bucket list.
+*
+* INPUTS:
+*       switchId         - logical switch id
+*       groupIdentifier  - 32 bit opaque group identifier
+*       bucketArraySize  - number of buckets in bucketArray, 0 - delete all
+*       bucketArray      - the new buckets of the group
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group or referenced group not found
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_NO_RESOURCE           - no room for the buckets
+*
+* COMMENTS:
+*       The groupIdentifier of every bucket must be groupIdentifier.
+*       For FPA_GROUP_L2_FLOOD_E and FPA_GROUP_L2_MULTICAST_E groups the
+*       resulting port bitmap is computed once from the whole list and the
+*       VIDX/multicast entry is written in a single hardware update, so a
+*       membership change costs one write regardless of the number of ports.
+*       Buckets not in the list are removed, buckets in the list are added
+*       or modified. On failure the group is left unchanged.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupEntryBucketSet
+(
+    IN   uint32_t                   switchId,
+    IN   uint32_t                   groupIdentifier,
+    IN   uint32_t                   bucketArraySize,
+    IN   FPA_GROUP_BUCKET_ENTRY_STC *bucketArray
+);
+
+/*******************************************************************************
+* fpaLibGroupEcmpSharedGet
+*
+* DESCRIPTION:
+*       Get the shared L3 ECMP group of a set of L3 unicast groups, creating
+*       it if it does not exist.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       numOfMembers      - number of groups in memberArray
+*       memberArray       - L3 unicast group identifiers, in any order
+*
+* OUTPUTS:
+*       groupIdentifierPtr - identifier of the shared L3 ECMP group
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NO_RESOURCE           - no room for a new ECMP group
+*       FPA_NOT_FOUND             - member group not found
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       Shared groups are found by content: the sorted member identifiers are
+*       hashed, and a group with the same member set is reused instead of
+*       building a duplicate. Every successful call increments the group
+*       reference count, to be decremented by fpaLibGroupEcmpSharedRelease.
+*       Shared groups are FPA_GROUP_L3_ECMP_E groups whose index is in the
+*       FPA_GROUP_ECMP_SHARED_INDEX_FIRST..FPA_GROUP_ECMP_SHARED_INDEX_LAST
+*       range. A new shared group takes an index not used by any group, so it
+*       never replaces a group added by the controller in this range.
+*       fpaLibGroupTableEntryAdd rejects L3 ECMP groups in this range only
+*       with the proposed change of README.md.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupEcmpSharedGet
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   numOfMembers,
+    IN    uint32_t   *memberArray,
+    OUT   uint32_t   *groupIdentifierPtr
+);
+
+/*******************************************************************************
+* fpaLibGroupEcmpSharedRelease
+*
+* DESCRIPTION:
+*       Release a shared L3 ECMP group.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - shared L3 ECMP group identifier
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - not a shared group
+*
+* COMMENTS:
+*       The group is deleted when its reference count drops to 0.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupEcmpSharedRelease
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier
+);
+
+/*******************************************************************************
+* fpaLibGroupEcmpSharedModify
+*
+* DESCRIPTION:
+*       Change the member set of a shared L3 ECMP group for all its owners.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - shared L3 ECMP group identifier
+*       numOfMembers      - number of groups in memberArray
+*       memberArray       - new L3 unicast group identifiers
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NO_RESOURCE           - no room for the new device ECMP block
+*       FPA_NOT_FOUND             - group or member group not found
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       The group identifier and its reference count do not change, so every
+*       owner keeps using and releasing the same identifier.
+*       Make before break: a device ECMP block with the new member set is
+*       written first, the group is switched to it in a single hardware
+*       update, and only then the old block is freed. The old block is never
+*       modified in place, so traffic always sees either the old or the new
+*       member set. On failure the group is left unchanged.
+*       If another shared group already has the new member set, both groups
+*       are kept and fpaLibGroupEcmpSharedGet returns the older one.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupEcmpSharedModify
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    IN    uint32_t   numOfMembers,
+    IN    uint32_t   *memberArray
+);
+
+/*******************************************************************************
+* fpaLibGroupEcmpSharedInfoGet
+*
+* DESCRIPTION:
+*       Get the information of a shared L3 ECMP group.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - shared L3 ECMP group identifier
+*
+* OUTPUTS:
+*       infoPtr           - (pointer to) the group information
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - not a shared group
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupEcmpSharedInfoGet
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    OUT   FPA_GROUP_ECMP_SHARED_INFO_STC *infoPtr
+);
+
+/*******************************************************************************
+* fpaLibGroupResilientHashSet
+*
+* DESCRIPTION:
+*       Set resilient hashing of a select group.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - 32 bit opaque group identifier
+*       numOfSlots        - number of indirection slots, 0 - regular hashing
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group not found
+*       FPA_NOT_SUPPORTED         - not a FPA_GROUP_ALGORITHM_HASH_ECMP_E select
+*                                   group, or resilient hashing not supported
+*                                   by the device
+*       FPA_BAD_PARAM             - numOfSlots is smaller than the number of
+*                                   buckets or not supported by the device
+*       FPA_NO_RESOURCE           - no room for the slot table
+*
+* COMMENTS:
+*       The flow hash selects a slot and the slot holds a bucket index.
+*       Removing a bucket reassigns only its own slots, adding a bucket takes
+*       the minimal number of slots from the others, so the rest of the flows
+*       keep their bucket. Groups are created with regular hashing.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupResilientHashSet
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    IN    uint32_t   numOfSlots
+);
+
+/*******************************************************************************
+* fpaLibGroupResilientHashGet
+*
+* DESCRIPTION:
+*       Get resilient hashing of a select group.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - 32 bit opaque group identifier
+*
+* OUTPUTS:
+*       numOfSlotsPtr     - number of indirection slots, 0 - regular hashing
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group not found
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupResilientHashGet
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    OUT   uint32_t   *numOfSlotsPtr
+);
+
+/*******************************************************************************
+* fpaLibGroupEntryBucketWeightSet
+*
+* DESCRIPTION:
+*       Set the weight of a select group bucket.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - 32 bit opaque group identifier
+*       bucketIndex       - index of the bucket in the group
+*       weight            - relative share of the group traffic, 1 or more
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group or bucket not found
+*       FPA_NOT_SUPPORTED         - not a select group
+*       FPA_NO_RESOURCE           - no room for the slot table
+*       FPA_BAD_PARAM             - weight is 0
+*
+* COMMENTS:
+*       Buckets are added with weight 1. Unequal weights are expanded by
+*       the library into an indirection slot table, see
+*       fpaLibGroupEcmpSlotTableGet.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupEntryBucketWeightSet
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    IN    uint32_t   bucketIndex,
+    IN    uint32_t   weight
+);
+
+/*******************************************************************************
+* fpaLibGroupEntryBucketWeightGet
+*
+* DESCRIPTION:
+*       Get the weight of a select group bucket.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - 32 bit opaque group identifier
+*       bucketIndex       - index of the bucket in the group
+*
+* OUTPUTS:
+*       weightPtr         - relative share of the group traffic
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group or bucket not found
+*       FPA_NOT_SUPPORTED         - not a select group
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupEntryBucketWeightGet
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    IN    uint32_t   bucketIndex,
+    OUT   uint32_t   *weightPtr
+);
+
+/*******************************************************************************
+* fpaLibGroupEcmpSlotTableGet
+*
+* DESCRIPTION:
+*       Get the indirection slot table of a resilient hashing or weighted
+*       select group.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - 32 bit opaque group identifier
+*       slotArraySize     - number of entries in slotArray
+*
+* OUTPUTS:
+*       slotArray         - bucket index held by every slot
+*       numOfSlotsPtr     - number of slots of the group
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group not found
+*       FPA_NOT_SUPPORTED         - group has no slot table
+*       FPA_BAD_SIZE              - slotArraySize is smaller than the number
+*                                   of slots, numOfSlotsPtr is still filled
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       The slot table is updated by fpaLibGroupEntryBucketAdd and
+*       fpaLibGroupEntryBucketDelete, see fpaLibGroupResilientHashSet.
+*       For a select group with unequal bucket weights, set by
+*       fpaLibGroupEntryBucketWeightSet, the weights are
+*       apportioned to slots by the largest remainder method, which gives
+*       the minimal deviation from the requested shares for the table size.
+*       Without resilient hashing the table size is the smallest that keeps
+*       the deviation within the device ECMP block limits, and groups with
+*       identical weight vectors and members share one device ECMP block.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupEcmpSlotTableGet
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    IN    uint32_t   slotArraySize,
+    OUT   uint32_t   *slotArray,
+    OUT   uint32_t   *numOfSlotsPtr
+);
+
+/*******************************************************************************
+* fpaLibGroupEntryBucketWatchSet
+*
+* DESCRIPTION:
+*       Set the watched port and group of a fast failover group bucket.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - 32 bit opaque group identifier
+*       bucketIndex       - index of the bucket in the group
+*       watchPort         - port whose link state determines the bucket
+*                           liveness, FPA_FLOW_INVALID_VAL - not watched
+*       watchGroup        - group whose liveness determines the bucket
+*                           liveness, FPA_FLOW_INVALID_VAL - not watched
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group, bucket or watched group not found
+*       FPA_NOT_SUPPORTED         - not a fast failover group
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       Buckets are added with no watched port and no watched group, as
+*       OFPP_ANY and OFPG_ANY.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupEntryBucketWatchSet
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    IN    uint32_t   bucketIndex,
+    IN    uint32_t   watchPort,
+    IN    uint32_t   watchGroup
+);
+
+/*******************************************************************************
+* fpaLibGroupEntryBucketWatchGet
+*
+* DESCRIPTION:
+*       Get the watched port and group of a fast failover group bucket.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - 32 bit opaque group identifier
+*       bucketIndex       - index of the bucket in the group
+*
+* OUTPUTS:
+*       watchPortPtr      - watched port, FPA_FLOW_INVALID_VAL - not watched
+*       watchGroupPtr     - watched group, FPA_FLOW_INVALID_VAL - not watched
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group or bucket not found
+*       FPA_NOT_SUPPORTED         - not a fast failover group
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupEntryBucketWatchGet
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    IN    uint32_t   bucketIndex,
+    OUT   uint32_t   *watchPortPtr,
+    OUT   uint32_t   *watchGroupPtr
+);
+
+/*******************************************************************************
+* fpaLibGroupFastFailoverStatusGet
+*
+* DESCRIPTION:
+*       Get the status of a fast failover group.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - 32 bit opaque group identifier
+*
+* OUTPUTS:
+*       statusPtr         - (pointer to) the group status
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group not found
+*       FPA_NOT_SUPPORTED         - not a fast failover group
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       All the buckets of a FPA_GROUP_FF group are programmed in the device
+*       in advance. On link down of a watched port, the library port event
+*       handler switches the active bucket in place, with no controller
+*       involvement. On link up the lower index bucket is restored.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupFastFailoverStatusGet
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    OUT   FPA_GROUP_FF_STATUS_STC *statusPtr
+);
+
+/*******************************************************************************
+* fpaLibGroupDependentsGet
+*
+* DESCRIPTION:
+*       Get the flows and group buckets directly referencing a group.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - 32 bit opaque group identifier
+*       resumeIndexPtr    - 0 to start from the first dependent
+*       dependentArraySize - number of entries in dependentArray
+*
+* OUTPUTS:
+*       resumeIndexPtr    - position to continue from, 0 if no more dependents
+*       dependentArray    - the group dependents
+*       numOfDependentsPtr - number of dependents filled
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group not found
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       The library keeps a dependency graph of flows, groups and buckets,
+*       updated by the flow, group and bucket add/modify/delete calls. The
+*       number of direct dependents is the referenceCount of
+*       FPA_GROUP_COUNTERS_STC.
+*       resumeIndex is a position in the dependents list of the group, not a
+*       snapshot: a dependent added or deleted between two calls can shift
+*       it, and another dependent can be skipped or reported twice.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupDependentsGet
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    INOUT uint32_t   *resumeIndexPtr,
+    IN    uint32_t   dependentArraySize,
+    OUT   FPA_GROUP_DEPENDENT_STC *dependentArray,
+    OUT   uint32_t   *numOfDependentsPtr
+);
+
+/*******************************************************************************
+* fpaLibGroupSubtreeDelete
+*
+* DESCRIPTION:
+*       Delete a group with the flows and buckets referencing it.
+*
+* INPUTS:
+*   	switchId          - The logical OpenFlow switch number.
+*       groupIdentifier   - 32 bit opaque group identifier
+*       deleteEmptied     - delete as well the groups left with no bucket,
+*                           with their own dependents
+*
+* OUTPUTS:
+*       numOfFlowsPtr     - number of deleted flows
+*       numOfBucketsPtr   - number of removed buckets of other groups
+*       numOfGroupsPtr    - number of deleted groups, including groupIdentifier
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group not found
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       Deletion is done in dependency order: flows first, then the buckets
+*       of other groups referencing the group, then the group itself, so no
+*       object ever references a deleted group. Only the referencing bucket
+*       is removed, so an ECMP, flood or multicast group keeps its other
+*       buckets. A group left with no bucket, such as an L3 unicast group
+*       whose only bucket referenced the group, is kept unless deleteEmptied
+*       is true; it is then deleted the same way, from the farthest one.
+*       The flows are deleted as by fpaLibFlowEntryDelete, including flow
+*       removed messages.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupSubtreeDelete
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    IN    bool       deleteEmptied,
+    OUT   uint32_t   *numOfFlowsPtr,
+    OUT   uint32_t   *numOfBucketsPtr,
+    OUT   uint32_t   *numOfGroupsPtr
+);
+
+/*******************************************************************************
+* fpaLibGroupDependentsRepoint
+*
+* DESCRIPTION:
+*       Point all the direct dependents of a group to another group.
+*
+* INPUTS:
+*   	switchId             - The logical OpenFlow switch number.
+*       groupIdentifier      - 32 bit opaque group identifier
+*       newGroupIdentifier   - the group to point to
+*
+* OUTPUTS:
+*       numOfRepointedPtr    - number of repointed flows and buckets
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_NOT_FOUND             - group not found
+*       FPA_BAD_PARAM             - new group type can not replace the group
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       The dependents are updated in one bulk hardware update per table.
+*       The groups are not deleted, the reference counts move from the group
+*       to the new group.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibGroupDependentsRepoint
+(
+    IN    uint32_t   switchId,
+    IN    uint32_t   groupIdentifier,
+    IN    uint32_t   newGroupIdentifier,
+    OUT   uint32_t   *numOfRepointedPtr
+);
+
+
+/******************************************************************************* 
+                            Packet Out APIs
+*******************************************************************************/
+
+/*******************************************************************************
+* fpaLibPktTxBufferAlloc
+*
+* DESCRIPTION:
+*       Allocate a buffer from the library TX buffer pool.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       bufferSize    - requested size in bytes
+*
+* OUTPUTS:
+*       bufferPtrPtr  - (pointer to) the allocated DMA-able buffer
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_NO_RESOURCE          - TX pool is empty
+*       FPA_BAD_PTR              - on NULL pointer
+*       FPA_BAD_SIZE             - bufferSize is bigger than a pool buffer
+*
+* COMMENTS:
+*       The caller writes the packet data directly into the buffer and
+*       passes it as a segment to fpaLibPortPktSendBurst, with no copy.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktTxBufferAlloc
+(
+    IN   uint32_t               switchId,
+    IN   uint32_t               bufferSize,
+    OUT  uint8_t                **bufferPtrPtr
+);
+
+/*******************************************************************************
+* fpaLibPktTxBufferFree
+*
+* DESCRIPTION:
+*       Return a buffer to the library TX buffer pool.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       bufferPtr     - buffer allocated by fpaLibPktTxBufferAlloc
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_BAD_PTR              - buffer is not from the TX pool
+*
+* COMMENTS:
+*       A buffer used in a sent packet may be freed or reused only after the
+*       packet completion is retrieved by fpaLibPktTxCompletionGet.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktTxBufferFree
+(
+    IN   uint32_t               switchId,
+    IN   uint8_t                *bufferPtr
+);
+
+/*******************************************************************************
+* fpaLibPortPktSendBurst
+*
+* DESCRIPTION:
+*       Transmit array of packets that the Controller sent to the switch
+*       (from CPU)
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       descArraySize - number of descriptors in descArray
+*       descArray     - (pointer to) array of packet descriptors
+*
+* OUTPUTS:
+*       numOfSentPtr  - number of packets queued for transmission
+*
+* RETURNS:
+*       FPA_OK                   - all the packets queued.
+*       FPA_FULL                 - TX ring is full, part of the packets queued
+*       FPA_BAD_PARAM            - wrong parameters
+*       FPA_BAD_PTR              - on NULL pointer
+*
+* COMMENTS:
+*       The packets are queued to the TX SDMA ring and the device is notified
+*       once for the whole burst. The call does not wait for transmission,
+*       the result of every queued packet is reported by
+*       fpaLibPktTxCompletionGet.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPortPktSendBurst
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       descArraySize,
+    IN   FPA_PACKET_OUT_BURST_DESC_STC  *descArray,
+    OUT  uint32_t                       *numOfSentPtr
+);
+
+/*******************************************************************************
+* fpaLibPktTxCompletionGet
+*
+* DESCRIPTION:
+*       Retrieve the completions of packets sent by fpaLibPortPktSendBurst.
+*
+* INPUTS:
+*       switchId        - The logical OpenFlow switch number
+*       arraySize       - number of entries in completionArray
+*
+* OUTPUTS:
+*       completionArray - (pointer to) array of packet completions
+*       numOfEntriesPtr - number of completions retrieved
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_NO_MORE              - Currently no more completions in queue
+*       FPA_BAD_PTR              - on NULL pointer
+*
+* COMMENTS:
+*       Non-blocking. Completions are returned in transmission order.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktTxCompletionGet
+(
+    IN   uint32_t                       switchId,
+    IN   uint32_t                       arraySize,
+    OUT  FPA_PACKET_OUT_COMPLETION_STC  *completionArray,
+    OUT  uint32_t                       *numOfEntriesPtr
+);
+
+
+/******************************************************************************* 
+                            Meter Table APIs
+*******************************************************************************/
+
+/*******************************************************************************
+* fpaLibMeterStatisticsChangedGet
+*
+* DESCRIPTION:
+*       Retrives the statistics of the meters whose counters changed since a
+*       given statistics generation.
+*
+* INPUTS:
+*       switchId        - The logical OpenFlow switch number
+*       sinceGeneration - generation returned by the previous query,
+*                         0 for all the meters
+*       resumeIndexPtr  - 0 to start from the first meter
+*       entryArraySize  - number of entries in entryArray
+*
+* OUTPUTS:
+*       resumeIndexPtr  - position to continue from, 0 if no more meters
+*       entryArray      - filled by the changed meters statistics
+*       numOfEntriesPtr - number of entries filled
+*       generationPtr   - statistics generation of the query
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       See fpaLibFlowTableStatisticsChangedGet, except that the pages are
+*       not taken from a snapshot: resumeIndex is a position in the meter
+*       table, so a meter added or deleted between two calls of the same query
+*       can shift it, and another meter can be skipped or reported twice.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibMeterStatisticsChangedGet
+(
+    IN    uint32_t                        switchId,
+    IN    uint64_t                        sinceGeneration,
+    INOUT uint32_t                        *resumeIndexPtr,
+    IN    uint32_t                        entryArraySize,
+    OUT   FPA_METER_STATISTICS_ENTRY_STC  *entryArray,
+    OUT   uint32_t                        *numOfEntriesPtr,
+    OUT   uint64_t                        *generationPtr
+);
+
+
+/******************************************************************************* 
+                            Statistics APIs
+*******************************************************************************/
+
+/*******************************************************************************
+* fpaLibStatisticsHarvesterSet
+*
+* DESCRIPTION:
+*       Configure the library counter harvester.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       cfgPtr        - (pointer to) harvester configuration
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PTR               - on NULL pointer
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       While the harvester runs, fpaLibPortStatisticsGet,
+*       fpaLibFlowEntryStatisticsGet, fpaLibGroupEntryStatisticsGet and
+*       fpaLibMeterStatisticsGet return the shadow counters without device
+*       access, unless they are older than maxStalenessMs. The shadow
+*       counters are 64 bit and do not wrap around at the hardware counter
+*       width. Every harvesting pass advances the statistics generation used
+*       by the *StatisticsChangedGet APIs.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibStatisticsHarvesterSet
+(
+    IN   uint32_t                           switchId,
+    IN   FPA_STATISTICS_HARVESTER_CFG_STC   *cfgPtr
+);
+
+/*******************************************************************************
+* fpaLibStatisticsHarvesterGet
+*
+* DESCRIPTION:
+*       Get the library counter harvester configuration.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*
+* OUTPUTS:
+*       cfgPtr        - (pointer to) harvester configuration
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PTR               - on NULL pointer
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibStatisticsHarvesterGet
+(
+    IN   uint32_t                           switchId,
+    OUT  FPA_STATISTICS_HARVESTER_CFG_STC   *cfgPtr
+);
+
+
+/******************************************************************************* 
+                            Events APIs
+*******************************************************************************/
+
+/*******************************************************************************
+* fpaLibSwitchEventsFdGet
+*
+* DESCRIPTION:
+*       Get the switch event file descriptor
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       eventfd file descriptor, or -1 on wrong parameters.
+*
+* COMMENTS:
+*       The descriptor is edge-triggered: it becomes readable when the
+*       packet-in, address update or port event queue turns from empty to
+*       not empty, or when an FDB flush completes, and is cleared by
+*       fpaLibSwitchEventsReadyGet. After it signals, the caller must drain
+*       every ready queue until FPA_NO_MORE by the non-blocking calls
+*       fpaLibPktRxDrain, fpaLibBridgingAuMsgGetBulk with non_blocking set,
+*       and fpaLibPortEventDrain. FPA_EVENT_READY_FDB_FLUSH is not a queue:
+*       it is reported once per completed flush, and the caller gets the
+*       result by fpaLibBridgingFdbFlushStatusGet with the identifier of the
+*       running flush. This lets a single epoll loop serve the whole switch.
+*
+*******************************************************************************/
+int fpaLibSwitchEventsFdGet
+(
+    IN   uint32_t  switchId
+);
+
+/*******************************************************************************
+* fpaLibSwitchEventsReadyGet
+*
+* DESCRIPTION:
+*       Get the ready switch event queues and clear the switch event fd
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*
+* OUTPUTS:
+*       readyBmpPtr   - bitmap of FPA_EVENT_READY_MASK_ENT, the not empty queues
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_BAD_PTR              - on NULL pointer
+*       FPA_BAD_PARAM            - wrong parameters
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibSwitchEventsReadyGet
+(
+    IN   uint32_t  switchId,
+    OUT  uint32_t  *readyBmpPtr
+);
+
+/*******************************************************************************
+* fpaLibPortEventDrain
+*
+* DESCRIPTION:
+*       Retrieve the queued port events, non-blocking
+*
+* INPUTS:
+*       switchId        - The logical OpenFlow switch number
+*       eventArraySize  - number of entries in eventArray
+*
+* OUTPUTS:
+*       eventArray      - (pointer to) array of port events
+*       numOfEventsPtr  - number of events retrieved
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_NO_MORE              - Currently no more events in queue
+*       FPA_BAD_PTR              - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPortEventDrain
+(
+    IN   uint32_t            switchId,
+    IN   uint32_t            eventArraySize,
+    OUT  FPA_PORT_EVENT_STC  *eventArray,
+    OUT  uint32_t            *numOfEventsPtr
+);
+
+/*******************************************************************************
+* fpaLibPortEventSimulate
+*
+* DESCRIPTION:
+*       Inject a port event as if it was received from the device
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       eventPtr      - (pointer to) the port event
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_BAD_PTR              - on NULL pointer
+*       FPA_BAD_PARAM            - wrong parameters
+*
+* COMMENTS:
+*       The event goes through the library port event handler, including
+*       fast failover group reaction, and is queued for fpaLibPortEventDrain.
+*       The port itself is not changed. Used for testing.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPortEventSimulate
+(
+    IN   uint32_t            switchId,
+    IN   FPA_PORT_EVENT_STC  *eventPtr
+);
+
+
+/******************************************************************************* 
+                            Packet In APIs
+*******************************************************************************/
+
+/*******************************************************************************
+* fpaLibPktReceiveBurst
+*
+* DESCRIPTION:
+*       Retrieve up to pktArraySize packets that the switch sent to the
+*       Controller (CPU)
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       timeout       - Indicates if the function is blocking or not, as in
+*                       fpaLibPktReceive
+*       pktArraySize  - number of packet buffers in pktArray
+*
+* OUTPUTS:
+*       pktArray      - (pointer to) array of packet buffers
+*       numOfPktsPtr  - number of packets retrieved
+*
+* RETURNS:
+*       FPA_OK                    - on success, at least one packet retrieved.
+*       FPA_FAIL	              - on failure
+*       FPA_NO_MORE		          - Currently no more packets in queue
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       Waits as fpaLibPktReceive for the first packet only, then returns all
+*       the packets already queued up to pktArraySize. The RX queue lock is
+*       taken and the SDMA descriptors are recycled once per burst.
+*       Every packet buffer is filled as by fpaLibPktReceive.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktReceiveBurst
+(
+    IN   uint32_t               switchId,
+    IN   uint32_t               timeout,
+    IN   uint32_t               pktArraySize,
+    OUT  FPA_PACKET_BUFFER_STC  *pktArray,
+    OUT  uint32_t               *numOfPktsPtr
+);
+
+/*******************************************************************************
+* fpaLibPktRxDrain
+*
+* DESCRIPTION:
+*       Retrieve up to pktArraySize queued packets, non-blocking
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       pktArraySize  - number of packet buffers in pktArray
+*
+* OUTPUTS:
+*       pktArray      - (pointer to) array of packet buffers
+*       numOfPktsPtr  - number of packets retrieved
+*
+* RETURNS:
+*       FPA_OK                    - on success, at least one packet retrieved.
+*       FPA_NO_MORE		          - Currently no more packets in queue
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*       Same as fpaLibPktReceiveBurst, but returns immediately when no packet
+*       is queued. Used with fpaLibSwitchEventsFdGet.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktRxDrain
+(
+    IN   uint32_t               switchId,
+    IN   uint32_t               pktArraySize,
+    OUT  FPA_PACKET_BUFFER_STC  *pktArray,
+    OUT  uint32_t               *numOfPktsPtr
+);
+
+/*******************************************************************************
+* fpaLibPktRxPoolSet
+*
+* DESCRIPTION:
+*       Set the packet-in buffer mode and buffer pool.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       cfgPtr        - (pointer to) buffer pool configuration
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PTR               - on NULL pointer
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_NO_RESOURCE           - failed to allocate the pool
+*       FPA_BAD_STATE             - pool buffers are still held by the caller
+*
+* COMMENTS:
+*       In zero copy mode fpaLibPktReceive and fpaLibPktReceiveBurst return
+*       pktDataPtr pointing directly into a pool buffer, with no copy and no
+*       allocation. The caller must return every buffer by
+*       fpaLibPktBufferRelease, otherwise the pool is exhausted and packets
+*       are dropped.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktRxPoolSet
+(
+    IN   uint32_t                  switchId,
+    IN   FPA_PKT_RX_POOL_CFG_STC   *cfgPtr
+);
+
+/*******************************************************************************
+* fpaLibPktBufferRelease
+*
+* DESCRIPTION:
+*       Return a packet-in buffer to the RX buffer pool.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       pktPtr        - (pointer to) packet buffer returned by the receive call
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PTR               - on NULL pointer or pktDataPtr not from the pool
+*
+* COMMENTS:
+*       Used in zero copy mode only. The packet data must not be accessed
+*       after the release.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktBufferRelease
+(
+    IN   uint32_t               switchId,
+    IN   FPA_PACKET_BUFFER_STC  *pktPtr
+);
+
+/*******************************************************************************
+* fpaLibPktRxPoolStatisticsGet
+*
+* DESCRIPTION:
+*       Get the packet-in buffer pool counters.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*
+* OUTPUTS:
+*       countersPtr   - (pointer to) buffer pool counters
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PTR               - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktRxPoolStatisticsGet
+(
+    IN   uint32_t                       switchId,
+    OUT  FPA_PKT_RX_POOL_COUNTERS_STC   *countersPtr
+);
+
+/*******************************************************************************
+* fpaLibPktRxQueueBind
+*
+* DESCRIPTION:
+*       Direct packet-in traffic to a packet-in queue.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       bindPtr       - (pointer to) the traffic criteria and the queue
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PTR               - on NULL pointer
+*       FPA_BAD_PARAM             - wrong parameters
+*       FPA_ALREADY_EXIST         - same criteria already bound
+*       FPA_NO_RESOURCE           - no more bindings
+*
+* COMMENTS:
+*       A packet goes to the queue of the first binding (in bind order) that
+*       it matches, packets that match no binding go to FPA_PKT_RX_QUEUE_DEFAULT.
+*       Every queue is mapped to its own CPU SDMA RX queue, so a flood on one
+*       queue does not delay packets of another one.
+*       Each queue has its own copy mode buffers, so a thread per queue
+*       receiving by fpaLibPktQueueReceive does not invalidate the packets of
+*       the other queues, see FPA_PKT_RX_BUFFER_MODE_ENT.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktRxQueueBind
+(
+    IN   uint32_t                    switchId,
+    IN   FPA_PKT_RX_QUEUE_BIND_STC   *bindPtr
+);
+
+/*******************************************************************************
+* fpaLibPktRxQueueUnbind
+*
+* DESCRIPTION:
+*       Remove a packet-in traffic binding.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       bindPtr       - (pointer to) the bound traffic criteria
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PTR               - on NULL pointer
+*       FPA_NOT_FOUND             - criteria not bound
+*
+* COMMENTS:
+*       queueId of bindPtr is ignored.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktRxQueueUnbind
+(
+    IN   uint32_t                    switchId,
+    IN   FPA_PKT_RX_QUEUE_BIND_STC   *bindPtr
+);
+
+/*******************************************************************************
+* fpaLibPktQueueReceive
+*
+* DESCRIPTION:
+*       Retrieve a single packet from a packet-in queue
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       queueId       - packet-in queue
+*       timeout       - Indicates if the function is blocking or not, as in
+*                       fpaLibPktReceive
+*
+* OUTPUTS:
+*       pktPtr	      - (pointer to) packet buffer
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_FAIL	              - on failure
+*       FPA_NO_MORE		          - Currently no more packets in queue
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       fpaLibPktReceive and fpaLibPktReceiveBurst serve all the queues in
+*       strict priority, higher queueId first.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktQueueReceive
+(
+    IN   uint32_t               switchId,
+    IN   uint32_t               queueId,
+    IN   uint32_t               timeout,
+    OUT  FPA_PACKET_BUFFER_STC  *pktPtr
+);
+
+/*******************************************************************************
+* fpaLibPktQueueReceiveBurst
+*
+* DESCRIPTION:
+*       Retrieve up to pktArraySize packets from a packet-in queue
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       queueId       - packet-in queue
+*       timeout       - Indicates if the function is blocking or not, as in
+*                       fpaLibPktReceive
+*       pktArraySize  - number of packet buffers in pktArray
+*
+* OUTPUTS:
+*       pktArray      - (pointer to) array of packet buffers
+*       numOfPktsPtr  - number of packets retrieved
+*
+* RETURNS:
+*       FPA_OK                    - on success, at least one packet retrieved.
+*       FPA_FAIL	              - on failure
+*       FPA_NO_MORE		          - Currently no more packets in queue
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       See fpaLibPktReceiveBurst.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktQueueReceiveBurst
+(
+    IN   uint32_t               switchId,
+    IN   uint32_t               queueId,
+    IN   uint32_t               timeout,
+    IN   uint32_t               pktArraySize,
+    OUT  FPA_PACKET_BUFFER_STC  *pktArray,
+    OUT  uint32_t               *numOfPktsPtr
+);
+
+/*******************************************************************************
+* fpaLibPktRxQueueFdGet
+*
+* DESCRIPTION:
+*       Get the event file descriptor of a packet-in queue
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       queueId       - packet-in queue
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       eventfd file descriptor, readable when the queue is not empty,
+*       or -1 on wrong parameters.
+*
+* COMMENTS:
+*       The descriptor may be polled by one thread per queue; the packets are
+*       retrieved by fpaLibPktQueueReceive or fpaLibPktQueueReceiveBurst.
+*
+*******************************************************************************/
+int fpaLibPktRxQueueFdGet
+(
+    IN   uint32_t               switchId,
+    IN   uint32_t               queueId
+);
+
+/*******************************************************************************
+* fpaLibPktRxQueuePolicerSet
+*
+* DESCRIPTION:
+*       Set the policer of a packet-in queue.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       queueId       - packet-in queue
+*       policerPtr    - (pointer to) policer parameters, all rates 0 - disable
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PTR               - on NULL pointer
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*       The policer is enforced by the device on the CPU SDMA RX queue of the
+*       packet-in queue, so packets above the rate are dropped before they
+*       reach the CPU ring. Use fpaLibPktRxQueueBind to give a reason or a
+*       table its own queue and policer.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktRxQueuePolicerSet
+(
+    IN   uint32_t                  switchId,
+    IN   uint32_t                  queueId,
+    IN   FPA_PKT_RX_POLICER_STC    *policerPtr
+);
+
+/*******************************************************************************
+* fpaLibPktRxQueuePolicerGet
+*
+* DESCRIPTION:
+*       Get the policer of a packet-in queue.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       queueId       - packet-in queue
+*
+* OUTPUTS:
+*       policerPtr    - (pointer to) policer parameters
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PTR               - on NULL pointer
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktRxQueuePolicerGet
+(
+    IN   uint32_t                  switchId,
+    IN   uint32_t                  queueId,
+    OUT  FPA_PKT_RX_POLICER_STC    *policerPtr
+);
+
+/*******************************************************************************
+* fpaLibPktRxQueuePolicerStatisticsGet
+*
+* DESCRIPTION:
+*       Get the policer counters of a packet-in queue.
+*
+* INPUTS:
+*       switchId      - The logical OpenFlow switch number
+*       queueId       - packet-in queue
+*
+* OUTPUTS:
+*       countersPtr   - (pointer to) policer counters
+*
+* RETURNS:
+*       FPA_OK                    - on success.
+*       FPA_BAD_PTR               - on NULL pointer
+*       FPA_BAD_PARAM             - wrong parameters
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibPktRxQueuePolicerStatisticsGet
+(
+    IN   uint32_t                          switchId,
+    IN   uint32_t                          queueId,
+    OUT  FPA_PKT_RX_POLICER_COUNTERS_STC   *countersPtr
+);
+
+
+/******************************************************************************* 
+                            Bridging APIs
+*******************************************************************************/
+
+/*******************************************************************************
+* fpaLibBridgingAuMsgGetBulk
+*
+* DESCRIPTION:
+*       Get up to msgArraySize New/Aged Address events in one call
+*
+* INPUTS:
+*       switchId         - The logical OpenFlow switch number.
+*   	non_blocking     - Indicates if the functions is blocking or not, as in
+*   					   fpaLibBridgingAuMsgGet
+*       msgArraySize     - number of entries in msgArray
+*
+* OUTPUTS:
+*       msgArray         - Msg data array.
+*       numOfMsgsPtr     - number of messages retrieved
+*
+* RETURNS:
+*       FPA_OK                   - on success, at least one message retrieved.
+*   	FPA_FAIL	             - could not get new address message
+*       FPA_NO_MORE				 - Currently no more messages in queue - Valid only in non-blocking mode
+*       FPA_BAD_PTR              - on NULL pointer
+*
+* COMMENTS:
+*       Blocks for the first message only, then returns all the messages
+*       already in the AU FIFO up to msgArraySize. The messages are read
+*       from the FIFO as one block and its descriptors are recycled once
+*       per call.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibBridgingAuMsgGetBulk
+(
+	IN   	uint32_t     switchId,
+	IN   	bool         non_blocking,
+	IN   	uint32_t     msgArraySize,
+	OUT 	FPA_EVENT_ADDRESS_MSG_STC *msgArray,
+	OUT 	uint32_t     *numOfMsgsPtr
+);
+
+/*******************************************************************************
+* fpaLibBridgingAuStatisticsGet
+*
+* DESCRIPTION:
+*       Get address update queue counters
+*
+* INPUTS:
+*       switchId         - The logical OpenFlow switch number.
+*
+* OUTPUTS:
+*       countersPtr      - (pointer to) address update counters
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_BAD_PTR              - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibBridgingAuStatisticsGet
+(
+	IN   	uint32_t     switchId,
+	OUT 	FPA_BRIDGING_AU_COUNTERS_STC *countersPtr
+);
+
+/*******************************************************************************
+* fpaLibBridgingFdbLookup
+*
+* DESCRIPTION:
+*       Find an address in the library shadow FDB
+*
+* INPUTS:
+*       switchId         - The logical OpenFlow switch number.
+*       vid              - VLAN id
+*       macAddrPtr       - (pointer to) MAC address
+*
+* OUTPUTS:
+*       entryPtr         - (pointer to) the shadow FDB entry
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_NOT_FOUND            - address not in FDB
+*       FPA_BAD_PTR              - on NULL pointer
+*
+* COMMENTS:
+*       The shadow FDB is a hash table keyed by (vid, MAC) in library memory,
+*       kept in sync with the device by the flow add/delete calls and by the
+*       address update messages, so no device access is done. An address
+*       learned on an interface different from the one in the shadow FDB is
+*       counted in macMoves, see fpaLibBridgingAuMovedReportSet.
+*       fpaLibFlowTableGetByEntry on FPA_FLOW_TABLE_TYPE_L2_FDB_E is served
+*       from the same table, see README.md.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibBridgingFdbLookup
+(
+	IN   	uint32_t     switchId,
+	IN   	uint16_t     vid,
+	IN   	FPA_MAC_ADDRESS_STC *macAddrPtr,
+	OUT 	FPA_BRIDGING_FDB_ENTRY_STC *entryPtr
+);
+
+/*******************************************************************************
+* fpaLibBridgingFdbStatisticsGet
+*
+* DESCRIPTION:
+*       Get the library shadow FDB counters
+*
+* INPUTS:
+*       switchId         - The logical OpenFlow switch number.
+*
+* OUTPUTS:
+*       countersPtr      - (pointer to) shadow FDB counters
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_BAD_PTR              - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibBridgingFdbStatisticsGet
+(
+	IN   	uint32_t     switchId,
+	OUT 	FPA_BRIDGING_FDB_COUNTERS_STC *countersPtr
+);
+
+/*******************************************************************************
+* fpaLibBridgingAuMovedReportSet
+*
+* DESCRIPTION:
+*       Set the address update message type of moved addresses.
+*
+* INPUTS:
+*       switchId         - The logical OpenFlow switch number.
+*       enable           - report moves as FPA_EVENT_ADDRESS_UPDATE_MOVED_E
+*                          (true) or as FPA_EVENT_ADDRESS_UPDATE_NEW_E (false)
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_BAD_PARAM            - wrong parameters
+*
+* COMMENTS:
+*       A moved address is a known address learned on an interface different
+*       from the one in the shadow FDB. The default is false, so address
+*       update consumers handling only NEW and AGED messages keep updating
+*       the address interface on a move. Moves are counted in macMoves of
+*       FPA_BRIDGING_FDB_COUNTERS_STC in both cases.
+*       FPA_EVENT_ADDRESS_UPDATE_MOVED_E is added to
+*       FPA_EVENT_ADDRESS_UPDATE_TYPE_ENT, see README.md.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibBridgingAuMovedReportSet
+(
+	IN   	uint32_t     switchId,
+	IN   	bool         enable
+);
+
+/*******************************************************************************
+* fpaLibBridgingAuMovedReportGet
+*
+* DESCRIPTION:
+*       Get the address update message type of moved addresses.
+*
+* INPUTS:
+*       switchId         - The logical OpenFlow switch number.
+*
+* OUTPUTS:
+*       enablePtr        - moves reported as FPA_EVENT_ADDRESS_UPDATE_MOVED_E
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_BAD_PTR              - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibBridgingAuMovedReportGet
+(
+	IN   	uint32_t     switchId,
+	OUT 	bool         *enablePtr
+);
+
+/*******************************************************************************
+* fpaLibBridgingFdbHashInfoGet
+*
+* DESCRIPTION:
+*       Get the device FDB bucket of an address
+*
+* INPUTS:
+*       switchId         - The logical OpenFlow switch number.
+*       vid              - VLAN id
+*       macAddrPtr       - (pointer to) MAC address
+*
+* OUTPUTS:
+*       hashInfoPtr      - (pointer to) bucket information
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_BAD_PTR              - on NULL pointer
+*
+* COMMENTS:
+*       Computed in software, with the device hash function and the shadow
+*       FDB occupancy, so a collision can be predicted before the add.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibBridgingFdbHashInfoGet
+(
+	IN   	uint32_t     switchId,
+	IN   	uint16_t     vid,
+	IN   	FPA_MAC_ADDRESS_STC *macAddrPtr,
+	OUT 	FPA_BRIDGING_FDB_HASH_INFO_STC *hashInfoPtr
+);
+
+/*******************************************************************************
+* fpaLibBridgingFdbRelocationSet
+*
+* DESCRIPTION:
+*       Set FDB entries relocation on bucket collision
+*
+* INPUTS:
+*       switchId         - The logical OpenFlow switch number.
+*       cfgPtr           - (pointer to) relocation configuration
+*
+* OUTPUTS:
+*       None
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_BAD_PTR              - on NULL pointer
+*       FPA_BAD_PARAM            - wrong parameters
+*
+* COMMENTS:
+*       When enabled and the bucket of a new FPA_FLOW_TABLE_TYPE_L2_BRIDGING_E
+*       entry is full, the library moves existing entries to free slots in
+*       their alternative buckets (cuckoo relocation), up to maxDepth moves,
+*       before writing the new entry. Every moved entry is written to its new
+*       slot before it is removed from the old one, so forwarding is not
+*       disturbed. fpaLibFlowEntryAdd returns FPA_NO_RESOURCE only if no
+*       relocation path is found.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibBridgingFdbRelocationSet
+(
+	IN   	uint32_t     switchId,
+	IN   	FPA_BRIDGING_FDB_RELOCATION_CFG_STC *cfgPtr
+);
+
+/*******************************************************************************
+* fpaLibBridgingFdbRelocationGet
+*
+* DESCRIPTION:
+*       Get FDB entries relocation configuration
+*
+* INPUTS:
+*       switchId         - The logical OpenFlow switch number.
+*
+* OUTPUTS:
+*       cfgPtr           - (pointer to) relocation configuration
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_BAD_PTR              - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibBridgingFdbRelocationGet
+(
+	IN   	uint32_t     switchId,
+	OUT 	FPA_BRIDGING_FDB_RELOCATION_CFG_STC *cfgPtr
+);
+
+/*******************************************************************************
+* fpaLibBridgingFdbFlush
+*
+* DESCRIPTION:
+*       Start flushing FDB entries by VLAN, port or trunk
+*
+* INPUTS:
+*       switchId         - The logical OpenFlow switch number.
+*       flushPtr         - (pointer to) flush criteria
+*
+* OUTPUTS:
+*       flushIdPtr       - identifier of the started flush
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_BAD_PTR              - on NULL pointer
+*       FPA_BAD_PARAM            - wrong parameters, or no criteria flag set
+*       FPA_NOT_READY            - previous flush is still running
+*
+* COMMENTS:
+*       The flush is done by the device FDB bulk flush (trigger action) and
+*       the call returns without waiting. The matching entries are removed
+*       from the shadow FDB at once. Completion is signaled by
+*       FPA_EVENT_READY_FDB_FLUSH on the switch event fd and reported by
+*       fpaLibBridgingFdbFlushStatusGet. No aged address update messages are
+*       sent for the flushed entries.
+*
+*******************************************************************************/
+FPA_STATUS fpaLibBridgingFdbFlush
+(
+	IN   	uint32_t     switchId,
+	IN   	FPA_BRIDGING_FDB_FLUSH_STC *flushPtr,
+	OUT 	uint32_t     *flushIdPtr
+);
+
+/*******************************************************************************
+* fpaLibBridgingFdbFlushStatusGet
+*
+* DESCRIPTION:
+*       Get the status of FDB flush
+*
+* INPUTS:
+*       switchId         - The logical OpenFlow switch number.
+*       flushId          - identifier returned by fpaLibBridgingFdbFlush
+*
+* OUTPUTS:
+*       donePtr          - true if the flush completed
+*       numOfFlushedPtr  - number of flushed entries
+*
+* RETURNS:
+*       FPA_OK                   - on success.
+*       FPA_NOT_FOUND            - unknown flush identifier
+*       FPA_BAD_PTR              - on NULL pointer
+*
+* COMMENTS:
+*
+*******************************************************************************/
+FPA_STATUS fpaLibBridgingFdbFlushStatusGet
+(
+	IN   	uint32_t     switchId,
+	IN   	uint32_t     flushId,
+	OUT 	bool         *donePtr,
+	OUT 	uint32_t     *numOfFlushedPtr
+);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */ 
+
+#endif /* __INCLUDE_FPA_API_EXT_H */
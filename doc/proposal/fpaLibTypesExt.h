@@ -0,0 +1,732 @@
+/*
+ *  Copyright (C) 2016. Marvell International Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+/*
+********************************************************************************
+* fpaLibTypesExt.h
+*
+* DESCRIPTION:
+*       OpenFlow FPA Library extension datatypes, used by the extension APIs
+*       of fpaLibApisExt.h. Design proposal, see README.md.
+*
+* FILE REVISION NUMBER:
+*       $Revision: 01 $
+*
+*******************************************************************************/
+#ifndef INCLUDE_FPA_DATATYPES_EXT_H
+#define INCLUDE_FPA_DATATYPES_EXT_H
+
+#ifndef FPA_LIB_EXT_APIS
+#error "fpaLibTypesExt.h is a design proposal, not implemented by libfpa"
+#endif /* FPA_LIB_EXT_APIS */
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#include <stdint.h>
+
+#include "fpaLibTypes.h"
+
+#define FPA_FLOW_TABLE_ALL  0xFF    /* all the flow tables, as OFPTT_ALL */
+
+/* flow transaction flags, correspond to OFPBF_ bundle flags */
+#define FPA_FLOW_TRANSACTION_ORDERED_FLAG   (1 << 0)  /* apply in staging order, no reordering */
+
+/* flow table cursor fields flags, select the copied FPA_FLOW_TABLE_ENTRY_STC fields */
+#define FPA_FLOW_TABLE_CURSOR_KEY_FLAG          (1 << 0)  /* entryType, priority and cookie */
+#define FPA_FLOW_TABLE_CURSOR_MATCH_FLAG        (1 << 1)  /* match fields of data */
+#define FPA_FLOW_TABLE_CURSOR_INSTRUCTIONS_FLAG (1 << 2)  /* instructions and actions of data */
+#define FPA_FLOW_TABLE_CURSOR_TIMEOUTS_FLAG     (1 << 3)  /* timeouts and flowModFlags */
+#define FPA_FLOW_TABLE_CURSOR_ALL_FLAGS         (0xF)
+
+/*
+ * typedef: struct FPA_FLOW_TABLE_STATISTICS_BULK_STC
+ *
+ * Description: Used in retrive statistics of many flow entries in one call.
+ *      The counters are kept as struct of arrays, entry i of the result is
+ *      described by element i of every array. All the arrays are allocated
+ *      by the caller with arraySize elements. The counters have the same
+ *      semantics as in FPA_FLOW_ENTRY_COUNTERS_STC.
+ *
+ * Fields:
+ *      arraySize        - number of elements in every array.
+ *      numOfEntries     - number of filled elements, set by the library.
+ *      resumeIndex      - 0 to start from the first entry of the table. The
+ *                         library sets it to the position in the snapshot of
+ *                         cursorId to continue from, or to 0 when the
+ *                         snapshot is exhausted.
+ *      cursorId         - snapshot cursor of the walk, as opened by
+ *                         fpaLibFlowTableCursorOpen. Set by the library on
+ *                         the call with resumeIndex 0 and passed unchanged
+ *                         by the resumed calls. The library closes it when
+ *                         resumeIndex returns to 0, a walk stopped before
+ *                         must close it by fpaLibFlowTableCursorClose.
+ *      cookieArray      - entry cookies.
+ *      packetCountArray - number of packets processed by the flow.
+ *      byteCountArray   - number of bytes processed by the flow.
+ *      durationSecArray - time the flow has been alive in seconds.
+ *
+ */
+typedef struct
+{
+    uint32_t  arraySize;
+    uint32_t  numOfEntries;
+    uint32_t  resumeIndex;
+    uint32_t  cursorId;
+    uint64_t  *cookieArray;
+    uint64_t  *packetCountArray;
+    uint64_t  *byteCountArray;
+    uint32_t  *durationSecArray;
+} FPA_FLOW_TABLE_STATISTICS_BULK_STC;
+
+/*
+ * typedef: struct FPA_FLOW_TABLE_LPM_OVERLAP_STC
+ *
+ * Description: Overlap of a route prefix with the installed routes of the
+ *      same VRF.
+ *
+ * Fields:
+ *      exactExists       - the same prefix is installed.
+ *      coveringExists    - a shorter installed prefix covers the prefix.
+ *      coveringPrefixLen - length of the longest covering prefix.
+ *      numOfMoreSpecific - number of longer installed prefixes covered by
+ *                          the prefix.
+ *
+ */
+typedef struct
+{
+    bool      exactExists;
+    bool      coveringExists;
+    uint32_t  coveringPrefixLen;
+    uint32_t  numOfMoreSpecific;
+} FPA_FLOW_TABLE_LPM_OVERLAP_STC;
+
+/*
+ * typedef: struct FPA_FLOW_TABLE_LPM_COUNTERS_STC
+ *
+ * Description: Used in get library route trie statistics.
+ *
+ * Fields:
+ *      numOfIpv4Prefixes - number of IPv4 prefixes in the trie.
+ *      numOfIpv6Prefixes - number of IPv6 prefixes in the trie.
+ *      memoryBytes       - memory used by the tries in bytes.
+ *
+ */
+typedef struct
+{
+    uint32_t  numOfIpv4Prefixes;
+    uint32_t  numOfIpv6Prefixes;
+    uint64_t  memoryBytes;
+} FPA_FLOW_TABLE_LPM_COUNTERS_STC;
+
+/*
+ * typedef: enum FPA_FLOW_TABLE_ROUTE_SYNC_MODE_ENT
+ *
+ * Description: Enumeration of route set synchronization modes.
+ *
+ * Enumerations:
+ *      FPA_FLOW_TABLE_ROUTE_SYNC_FULL_E    - the set is the full desired route
+ *                                            set of the VRF, installed routes
+ *                                            not in the set are deleted.
+ *      FPA_FLOW_TABLE_ROUTE_SYNC_PARTIAL_E - the set holds only the changed
+ *                                            routes, withdrawn routes are
+ *                                            marked by the withdraw field.
+ *
+ * Comments:
+ *         None.
+ */
+typedef enum
+{
+    FPA_FLOW_TABLE_ROUTE_SYNC_FULL_E,
+    FPA_FLOW_TABLE_ROUTE_SYNC_PARTIAL_E,
+    FPA_FLOW_TABLE_ROUTE_SYNC_MAX_E = 0xFFFFFFFF
+} FPA_FLOW_TABLE_ROUTE_SYNC_MODE_ENT;
+
+/*
+ * typedef: struct FPA_FLOW_TABLE_ROUTE_SYNC_ENTRY_STC
+ *
+ * Description: Route of a route set.
+ *
+ * Fields:
+ *      withdraw  - delete the route, used in partial mode only.
+ *      flowEntry - the L3 unicast route flow entry.
+ *
+ */
+typedef struct
+{
+    bool                      withdraw;
+    FPA_FLOW_TABLE_ENTRY_STC  flowEntry;
+} FPA_FLOW_TABLE_ROUTE_SYNC_ENTRY_STC;
+
+/*
+ * typedef: struct FPA_FLOW_TABLE_ROUTE_SYNC_RESULT_STC
+ *
+ * Description: Result of route set synchronization.
+ *
+ * Fields:
+ *      numOfAdded       - number of added routes.
+ *      numOfModified    - number of routes with changed instructions.
+ *      numOfDeleted     - number of deleted routes.
+ *      numOfUnchanged   - number of routes already installed as requested.
+ *      numOfFailed      - number of routes of the route array which could
+ *                         not be applied, withdrawn routes included.
+ *      firstFailedIndex - index in the route array of the first failed
+ *                         route, FPA_FLOW_INVALID_VAL if numOfFailed is 0.
+ *      numOfFailedDeletes - number of installed routes missing from a full
+ *                         route set which could not be deleted. These routes
+ *                         are not in the route array. Always 0 in partial
+ *                         mode.
+ *      firstFailedDelete - the first installed route which could not be
+ *                         deleted, valid if numOfFailedDeletes is not 0.
+ *
+ */
+typedef struct
+{
+    uint32_t  numOfAdded;
+    uint32_t  numOfModified;
+    uint32_t  numOfDeleted;
+    uint32_t  numOfUnchanged;
+    uint32_t  numOfFailed;
+    uint32_t  firstFailedIndex;
+    uint32_t  numOfFailedDeletes;
+    FPA_FLOW_TABLE_ENTRY_STC  firstFailedDelete;
+} FPA_FLOW_TABLE_ROUTE_SYNC_RESULT_STC;
+
+
+/******************************************************************************* 
+                            Group Table Section
+*******************************************************************************/
+
+/*
+ * typedef: struct FPA_GROUP_STATISTICS_ENTRY_STC
+ *
+ * Description: Used in retrive statistics of many groups in one call.
+ *
+ * Fields:
+ *      groupIdentifier - 32 bit opaque group identifier.
+ *      counters        - the group counters.
+ *
+ */
+typedef struct
+{
+    uint32_t                groupIdentifier;
+    FPA_GROUP_COUNTERS_STC  counters;
+} FPA_GROUP_STATISTICS_ENTRY_STC;
+
+/* index [27:0] range of the shared L3 ECMP group identifiers, reserved for
+ * fpaLibGroupEcmpSharedGet, see README.md */
+#define FPA_GROUP_ECMP_SHARED_INDEX_FIRST   0x0F000000
+#define FPA_GROUP_ECMP_SHARED_INDEX_LAST    0x0FFFFFFF
+
+/*
+ * typedef: struct FPA_GROUP_ECMP_SHARED_INFO_STC
+ *
+ * Description: Information of a shared L3 ECMP group.
+ *
+ * Fields:
+ *      referenceCount - number of owners got the group by fpaLibGroupEcmpSharedGet
+ *                       and not released it.
+ *      numOfMembers   - number of member L3 unicast groups.
+ *      membersHash    - hash of the sorted member group identifiers, the
+ *                       content address of the group.
+ *
+ */
+typedef struct
+{
+    uint32_t  referenceCount;
+    uint32_t  numOfMembers;
+    uint64_t  membersHash;
+} FPA_GROUP_ECMP_SHARED_INFO_STC;
+
+/*
+ * typedef: struct FPA_GROUP_FF_STATUS_STC
+ *
+ * Description: Status of a fast failover group. The active bucket is the
+ *      live bucket with the lowest index; a bucket is live if its watched
+ *      port link is up and its watched group has a live bucket.
+ *
+ * Fields:
+ *      activeBucketIndex - index of the active bucket, FPA_FLOW_INVALID_VAL if
+ *                          no bucket is live.
+ *      failoverCount     - number of active bucket changes.
+ *      lastReactionUsec  - time from the last port event to the hardware update
+ *                          of the active bucket, in microseconds.
+ *
+ */
+typedef struct
+{
+    uint32_t  activeBucketIndex;
+    uint32_t  failoverCount;
+    uint32_t  lastReactionUsec;
+} FPA_GROUP_FF_STATUS_STC;
+
+/*
+ * typedef: enum FPA_GROUP_DEPENDENT_TYPE_ENT
+ *
+ * Description: Enumeration of the objects referencing a group.
+ *
+ * Enumerations:
+ *      FPA_GROUP_DEPENDENT_FLOW_E   - flow entry with the group in its actions.
+ *      FPA_GROUP_DEPENDENT_BUCKET_E - bucket of another group referencing the
+ *                                     group (referenceGroupId or refGroupId).
+ *
+ * Comments:
+ *         None.
+ */
+typedef enum
+{
+    FPA_GROUP_DEPENDENT_FLOW_E,
+    FPA_GROUP_DEPENDENT_BUCKET_E,
+    FPA_GROUP_DEPENDENT_MAX_E = 0xFFFFFFFF
+} FPA_GROUP_DEPENDENT_TYPE_ENT;
+
+/*
+ * typedef: struct FPA_GROUP_DEPENDENT_STC
+ *
+ * Description: Object directly referencing a group.
+ *
+ * Fields:
+ *      type            - the dependent type.
+ *      flowTableNo     - flow table of a flow dependent.
+ *      flowEntry       - the flow entry of a flow dependent, as returned by
+ *                        fpaLibFlowTableGetByEntry. Its match fields identify
+ *                        the flow, the cookie may be 0 or shared by other
+ *                        flows.
+ *      groupIdentifier - group of a bucket dependent.
+ *      bucketIndex     - bucket index of a bucket dependent.
+ *
+ */
+typedef struct
+{
+    FPA_GROUP_DEPENDENT_TYPE_ENT  type;
+    uint32_t                      flowTableNo;
+    FPA_FLOW_TABLE_ENTRY_STC      flowEntry;
+    uint32_t                      groupIdentifier;
+    uint32_t                      bucketIndex;
+} FPA_GROUP_DEPENDENT_STC;
+
+
+/******************************************************************************* 
+                            Meter Table Section
+*******************************************************************************/
+
+/*
+ * typedef: struct FPA_METER_STATISTICS_ENTRY_STC
+ *
+ * Description: Used in retrive statistics of many meters in one call.
+ *
+ * Fields:
+ *      meterIdentifier - meter identifier.
+ *      counters        - the meter counters.
+ *
+ */
+typedef struct
+{
+    uint32_t                meterIdentifier;
+    FPA_METER_COUNTERS_STC  counters;
+} FPA_METER_STATISTICS_ENTRY_STC;
+
+
+/******************************************************************************* 
+                            Statistics Section
+*******************************************************************************/
+
+/*
+ * typedef: struct FPA_STATISTICS_HARVESTER_CFG_STC
+ *
+ * Description: Configuration of the library counter harvester. The harvester
+ *      is a library thread which periodically reads all the port, flow, group
+ *      and meter counter blocks of the device and accumulates them into 64
+ *      bit shadow counters, handling the hardware counters wrap around.
+ *
+ * Fields:
+ *      enable         - run the harvester (true) or read the device on every
+ *                       *StatisticsGet call (false, default).
+ *      intervalMs     - time between two harvesting passes in milliseconds.
+ *      maxStalenessMs - maximal age of the shadow counters served to the
+ *                       caller, older counters are read from the device
+ *                       synchronously. 0 - always serve the shadow counters.
+ *
+ */
+typedef struct
+{
+    bool      enable;
+    uint32_t  intervalMs;
+    uint32_t  maxStalenessMs;
+} FPA_STATISTICS_HARVESTER_CFG_STC;
+
+
+/******************************************************************************* 
+                            Packet In and Packet Out Section
+*******************************************************************************/
+
+/*
+ * typedef: enum FPA_PKT_RX_BUFFER_MODE_ENT
+ *
+ * Description: Enumeration of packet-in buffer modes.
+ *
+ * Enumerations:
+ *      FPA_PKT_RX_BUFFER_MODE_COPY_E      - packet data is copied out of the RX
+ *                                           ring on receive (default).
+ *      FPA_PKT_RX_BUFFER_MODE_ZERO_COPY_E - packet data stays in the RX buffer
+ *                                           pool until released by the caller.
+ *
+ * Comments:
+ *         pktDataPtr of FPA_PACKET_BUFFER_STC is owned by the library. In copy
+ *         mode it is valid until the next receive call on the packet-in queue
+ *         the packet came from; fpaLibPktReceive and fpaLibPktReceiveBurst
+ *         count as a receive call on every queue. In zero copy mode it points
+ *         into the RX buffer pool and is valid until released by
+ *         fpaLibPktBufferRelease.
+ */
+typedef enum
+{
+    FPA_PKT_RX_BUFFER_MODE_COPY_E,
+    FPA_PKT_RX_BUFFER_MODE_ZERO_COPY_E,
+    FPA_PKT_RX_BUFFER_MODE_MAX_E = 0xFFFFFFFF
+} FPA_PKT_RX_BUFFER_MODE_ENT;
+
+/*
+ * typedef: struct FPA_PKT_RX_POOL_CFG_STC
+ *
+ * Description: Configuration of the packet-in buffer pool. The pool buffers
+ *      are allocated by the library from pinned DMA memory and are given
+ *      directly to the RX SDMA rings.
+ *
+ * Fields:
+ *      mode         - packet-in buffer mode.
+ *      numOfBuffers - number of buffers in the pool, used in zero copy mode.
+ *      bufferSize   - size of a pool buffer in bytes, used in zero copy mode.
+ *
+ */
+typedef struct
+{
+    FPA_PKT_RX_BUFFER_MODE_ENT  mode;
+    uint32_t                    numOfBuffers;
+    uint32_t                    bufferSize;
+} FPA_PKT_RX_POOL_CFG_STC;
+
+/*
+ * typedef: struct FPA_PKT_RX_POOL_COUNTERS_STC
+ *
+ * Description: Used in get packet-in buffer pool statistics.
+ *
+ * Fields:
+ *      buffersInUse   - number of buffers held by the caller, not yet released.
+ *      exhaustedCount - number of packets dropped because no free pool buffer
+ *                       was available for the RX ring.
+ *
+ */
+typedef struct
+{
+    uint32_t  buffersInUse;
+    uint64_t  exhaustedCount;
+} FPA_PKT_RX_POOL_COUNTERS_STC;
+
+#define FPA_PKT_RX_QUEUES_MAX       8
+#define FPA_PKT_RX_QUEUE_DEFAULT    0
+
+/* packet-in queue binding criteria flags */
+#define FPA_PKT_RX_QUEUE_BIND_REASON_FLAG   (1 << 0)  /* match reasonBmp */
+#define FPA_PKT_RX_QUEUE_BIND_TABLE_FLAG    (1 << 1)  /* match tableId */
+#define FPA_PKT_RX_QUEUE_BIND_CTRL_PKT_FLAG (1 << 2)  /* match ctrlPktType */
+
+/*
+ * typedef: struct FPA_PKT_RX_QUEUE_BIND_STC
+ *
+ * Description: Binding of packet-in traffic to a packet-in queue. A packet
+ *      matches the binding if it matches all the criteria selected by flags.
+ *      With no flag set all the packets match.
+ *
+ * Fields:
+ *      flags       - bitmap of FPA_PKT_RX_QUEUE_BIND_*_FLAG.
+ *      reasonBmp   - bitmap of (1 << FPA_PACKET_IN_REASON_ENT).
+ *      tableId     - flow table which sent the packet.
+ *      ctrlPktType - control packet entry type of a FPA_FLOW_TABLE_TYPE_CONTROL_PKT_E
+ *                    table packet.
+ *      queueId     - packet-in queue, 0..FPA_PKT_RX_QUEUES_MAX-1.
+ *
+ */
+typedef struct
+{
+    uint32_t                          flags;
+    uint32_t                          reasonBmp;
+    FPA_FLOW_TABLE_ID_t               tableId;
+    FPA_CONTROL_PKTS_ENTRY_TYPE_ENT   ctrlPktType;
+    uint32_t                          queueId;
+} FPA_PKT_RX_QUEUE_BIND_STC;
+
+/*
+ * typedef: struct FPA_PKT_RX_POLICER_STC
+ *
+ * Description: Token bucket policer of a packet-in queue. A packet is passed
+ *      only if both the packet and the byte buckets have enough tokens.
+ *
+ * Fields:
+ *      pktRate   - rate in packets/sec, 0 - no packet rate limit.
+ *      pktBurst  - packet bucket size in packets.
+ *      byteRate  - rate in bytes/sec, 0 - no byte rate limit.
+ *      byteBurst - byte bucket size in bytes.
+ *
+ */
+typedef struct
+{
+    uint32_t  pktRate;
+    uint32_t  pktBurst;
+    uint32_t  byteRate;
+    uint32_t  byteBurst;
+} FPA_PKT_RX_POLICER_STC;
+
+/*
+ * typedef: struct FPA_PKT_RX_POLICER_COUNTERS_STC
+ *
+ * Description: Used in get packet-in queue policer statistics.
+ *
+ * Fields:
+ *      passedPackets  - number of packets passed to the queue.
+ *      droppedPackets - number of packets dropped by the policer.
+ *      droppedBytes   - number of bytes dropped by the policer.
+ *
+ */
+typedef struct
+{
+    uint64_t  passedPackets;
+    uint64_t  droppedPackets;
+    uint64_t  droppedBytes;
+} FPA_PKT_RX_POLICER_COUNTERS_STC;
+
+#define FPA_PACKET_OUT_SEGMENTS_MAX 4
+
+/*
+ * typedef: struct FPA_PACKET_SEGMENT_STC
+ *
+ * Description: Packet data segment, used for scatter-gather packet out.
+ *
+ * Fields:
+ *      dataPtr  - segment data, preferably in a TX pool buffer.
+ *      dataSize - segment size in bytes.
+ *
+ */
+typedef struct
+{
+  uint8_t                   *dataPtr;
+  uint32_t                  dataSize;
+} FPA_PACKET_SEGMENT_STC;
+
+/*
+ * typedef: struct FPA_PACKET_OUT_BURST_DESC_STC
+ *
+ * Description: Packet out descriptor used in burst send. The packet is the
+ *      concatenation of its segments. Segments in TX pool buffers are given
+ *      to the SDMA as is, other segments are copied.
+ *
+ * Fields:
+ *      outPortNum    - egress port.
+ *      inPortNum     - source port that the packet was ingressed.
+ *      numOfSegments - number of valid segments.
+ *      segment       - packet data segments.
+ *      userCookie    - opaque value returned in the packet completion.
+ *
+ */
+typedef struct
+{
+  uint32_t                  outPortNum;
+  uint32_t                  inPortNum;
+  uint32_t                  numOfSegments;
+  FPA_PACKET_SEGMENT_STC    segment[FPA_PACKET_OUT_SEGMENTS_MAX];
+  uint64_t                  userCookie;
+} FPA_PACKET_OUT_BURST_DESC_STC;
+
+/*
+ * typedef: struct FPA_PACKET_OUT_COMPLETION_STC
+ *
+ * Description: Completion of a packet sent by burst send.
+ *
+ * Fields:
+ *      userCookie - userCookie of the packet descriptor.
+ *      status     - FPA_OK if the packet was transmitted.
+ *
+ */
+typedef struct
+{
+  uint64_t                  userCookie;
+  FPA_STATUS                status;
+} FPA_PACKET_OUT_COMPLETION_STC;
+
+
+/******************************************************************************* 
+                            Events Section
+*******************************************************************************/
+
+/* Switch event queues readiness, signaled by the switch event fd */
+typedef enum
+{
+  /* Packet-in queue not empty */
+  FPA_EVENT_READY_PACKET_IN = 1 << 0,
+
+  /* Address update queue not empty */
+  FPA_EVENT_READY_ADDRESS_UPDATE = 1 << 1,
+
+  /* Port event queue not empty */
+  FPA_EVENT_READY_PORT = 1 << 2,
+
+  /* FDB flush completed */
+  FPA_EVENT_READY_FDB_FLUSH = 1 << 3,
+
+} FPA_EVENT_READY_MASK_ENT;
+
+
+/******************************************************************************* 
+                            Bridging Section
+*******************************************************************************/
+
+/*
+ * typedef: struct FPA_BRIDGING_AU_COUNTERS_STC
+ *
+ * Description: Used in get address update queue statistics.
+ *
+ * Fields:
+ *      msgReceived   - number of messages delivered to the caller.
+ *      msgLost       - number of messages lost because the AU queue was full.
+ *      overflowCount - number of times the AU queue became full.
+ *
+ */
+typedef struct
+{
+    uint64_t  msgReceived;
+    uint64_t  msgLost;
+    uint64_t  overflowCount;
+} FPA_BRIDGING_AU_COUNTERS_STC;
+
+/*
+ * typedef: struct FPA_BRIDGING_FDB_ENTRY_STC
+ *
+ * Description: Entry of the library shadow FDB.
+ *
+ * Fields:
+ *      vid           - VLAN id.
+ *      address       - MAC address.
+ *      interfaceType - type of the interface the address is bound to.
+ *      interfaceNum  - port, trunk or vidx number according interfaceType.
+ *      isStatic      - entry added by flow add (true) or learned (false).
+ *      cookie        - flow entry cookie of a static entry, 0 otherwise.
+ *
+ */
+typedef struct
+{
+    uint16_t                vid;
+    FPA_MAC_ADDRESS_STC     address;
+    FPA_INTERFACE_TYPE_ENT  interfaceType;
+    uint32_t                interfaceNum;
+    bool                    isStatic;
+    uint64_t                cookie;
+} FPA_BRIDGING_FDB_ENTRY_STC;
+
+/*
+ * typedef: struct FPA_BRIDGING_FDB_COUNTERS_STC
+ *
+ * Description: Used in get shadow FDB statistics.
+ *
+ * Fields:
+ *      numOfEntries  - number of entries in the shadow FDB.
+ *      numOfStatic   - number of static entries.
+ *      macMoves      - number of addresses that moved to another interface.
+ *      relocations   - number of entries moved to another slot to free room
+ *                      for a new entry.
+ *      relocationFailures - number of entries not added since no relocation
+ *                      path was found.
+ *
+ */
+typedef struct
+{
+    uint32_t  numOfEntries;
+    uint32_t  numOfStatic;
+    uint64_t  macMoves;
+    uint64_t  relocations;
+    uint64_t  relocationFailures;
+} FPA_BRIDGING_FDB_COUNTERS_STC;
+
+/*
+ * typedef: struct FPA_BRIDGING_FDB_HASH_INFO_STC
+ *
+ * Description: Position of an address in the device FDB, as computed by the
+ *      library model of the device FDB hash function.
+ *
+ * Fields:
+ *      bucketIndex    - index of the hash bucket of the address.
+ *      bucketSize     - number of slots in a bucket.
+ *      numOfFreeSlots - number of free slots in the bucket.
+ *
+ */
+typedef struct
+{
+    uint32_t  bucketIndex;
+    uint32_t  bucketSize;
+    uint32_t  numOfFreeSlots;
+} FPA_BRIDGING_FDB_HASH_INFO_STC;
+
+/*
+ * typedef: struct FPA_BRIDGING_FDB_RELOCATION_CFG_STC
+ *
+ * Description: Configuration of FDB entries relocation on bucket collision.
+ *
+ * Fields:
+ *      enable   - relocate entries (true) or fail the add (false).
+ *      maxDepth - maximal number of entries moved to add one entry.
+ *
+ */
+typedef struct
+{
+    bool      enable;
+    uint32_t  maxDepth;
+} FPA_BRIDGING_FDB_RELOCATION_CFG_STC;
+
+/* FDB flush criteria flags */
+#define FPA_BRIDGING_FDB_FLUSH_VLAN_FLAG        (1 << 0)  /* match vid */
+#define FPA_BRIDGING_FDB_FLUSH_INTERFACE_FLAG   (1 << 1)  /* match interfaceType and interfaceNum */
+#define FPA_BRIDGING_FDB_FLUSH_STATIC_FLAG      (1 << 2)  /* flush static entries as well */
+#define FPA_BRIDGING_FDB_FLUSH_ALL_FLAG         (1 << 3)  /* match all the entries */
+
+/*
+ * typedef: struct FPA_BRIDGING_FDB_FLUSH_STC
+ *
+ * Description: FDB flush criteria. An entry is flushed if it matches all the
+ *      criteria selected by flags. Flushing all the dynamic entries of the
+ *      switch requires FPA_BRIDGING_FDB_FLUSH_ALL_FLAG, which can not be
+ *      combined with the VLAN and interface flags. Flags 0 is rejected.
+ *
+ * Fields:
+ *      flags         - bitmap of FPA_BRIDGING_FDB_FLUSH_*_FLAG.
+ *      vid           - VLAN id.
+ *      interfaceType - FPA_INTERFACE_PORT_E or FPA_INTERFACE_TRUNK_E.
+ *      interfaceNum  - port or trunk number.
+ *
+ */
+typedef struct
+{
+    uint32_t                flags;
+    uint16_t                vid;
+    FPA_INTERFACE_TYPE_ENT  interfaceType;
+    uint32_t                interfaceNum;
+} FPA_BRIDGING_FDB_FLUSH_STC;
+
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */ 
+
+#endif /* INCLUDE_FPA_DATATYPES_EXT_H */
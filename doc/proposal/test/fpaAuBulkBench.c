@@ -0,0 +1,164 @@
+/*
+ *  Copyright (C) 2016. Marvell International Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+/*
+********************************************************************************
+* fpaAuBulkBench.c
+*
+* DESCRIPTION:
+*       Address update benchmark: sustained messages/sec of
+*       fpaLibBridgingAuMsgGet versus fpaLibBridgingAuMsgGetBulk for bulk
+*       sizes 1 to FPA_BENCH_MAX_BULK, with the AU queue counters of every run.
+*
+*       Usage: fpaAuBulkBench [switchId] [seconds]
+*
+*       Source MAC learning reports new addresses to the controller, and a
+*       traffic generator sends frames with incrementing source MAC addresses
+*       during the whole run, above the rate the CPU can drain.
+*       Acceptance: every bulk size above 1 beats fpaLibBridgingAuMsgGet, and
+*       the largest bulk size loses fewer messages than fpaLibBridgingAuMsgGet.
+*
+* FILE REVISION NUMBER:
+*       $Revision: 01 $
+*
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "fpaLibApisExt.h"
+
+#define FPA_BENCH_MAX_BULK      256
+
+static FPA_EVENT_ADDRESS_MSG_STC msgArray[FPA_BENCH_MAX_BULK];
+
+static double fpaBenchTimeGet(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* bulkSize 0 - fpaLibBridgingAuMsgGet */
+static FPA_STATUS fpaBenchRun
+(
+    IN   uint32_t  switchId,
+    IN   uint32_t  bulkSize,
+    IN   double    seconds,
+    OUT  double    *msgRatePtr,
+    OUT  uint64_t  *msgLostPtr
+)
+{
+    FPA_STATUS  rc;
+    FPA_BRIDGING_AU_COUNTERS_STC startCounters, endCounters;
+    uint64_t    numOfMsgs = 0;
+    uint32_t    numOfBulkMsgs;
+    double      start, now;
+
+    rc = fpaLibBridgingAuStatisticsGet(switchId, &startCounters);
+    if (rc != FPA_OK)
+    {
+        return rc;
+    }
+
+    start = now = fpaBenchTimeGet();
+    while (now - start < seconds)
+    {
+        if (bulkSize == 0)
+        {
+            rc = fpaLibBridgingAuMsgGet(switchId, true, &msgArray[0]);
+            numOfBulkMsgs = 1;
+        }
+        else
+        {
+            rc = fpaLibBridgingAuMsgGetBulk(switchId, true, bulkSize,
+                                            msgArray, &numOfBulkMsgs);
+        }
+        if (rc == FPA_OK)
+        {
+            numOfMsgs += numOfBulkMsgs;
+        }
+        else if (rc != FPA_NO_MORE)
+        {
+            return rc;
+        }
+        now = fpaBenchTimeGet();
+    }
+
+    rc = fpaLibBridgingAuStatisticsGet(switchId, &endCounters);
+    if (rc != FPA_OK)
+    {
+        return rc;
+    }
+
+    *msgRatePtr = (double)numOfMsgs / (now - start);
+    *msgLostPtr = endCounters.msgLost - startCounters.msgLost;
+    return FPA_OK;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t    switchId = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 0;
+    double      seconds = (argc > 2) ? strtod(argv[2], NULL) : 10.0;
+    uint32_t    bulkSize;
+    double      msgRate, singleMsgRate;
+    uint64_t    msgLost, singleMsgLost;
+    bool        pass = true;
+    FPA_STATUS  rc;
+
+    rc = fpaLibInit();
+    if (rc != FPA_OK)
+    {
+        fprintf(stderr, "fpaLibInit failed, rc %ld\n", (long)rc);
+        return 1;
+    }
+
+    rc = fpaBenchRun(switchId, 0, seconds, &singleMsgRate, &singleMsgLost);
+    if (rc != FPA_OK)
+    {
+        fprintf(stderr, "fpaLibBridgingAuMsgGet failed, rc %ld\n", (long)rc);
+        return 1;
+    }
+    printf("%-24s %12.0f msgs/sec %12llu lost\n", "fpaLibBridgingAuMsgGet",
+           singleMsgRate, (unsigned long long)singleMsgLost);
+
+    for (bulkSize = 1; bulkSize <= FPA_BENCH_MAX_BULK; bulkSize *= 2)
+    {
+        rc = fpaBenchRun(switchId, bulkSize, seconds, &msgRate, &msgLost);
+        if (rc != FPA_OK)
+        {
+            fprintf(stderr, "fpaLibBridgingAuMsgGetBulk failed, rc %ld\n",
+                    (long)rc);
+            return 1;
+        }
+        printf("bulk %-19u %12.0f msgs/sec %12llu lost\n", bulkSize, msgRate,
+               (unsigned long long)msgLost);
+        if (bulkSize > 1 && msgRate <= singleMsgRate)
+        {
+            pass = false;
+        }
+        if (bulkSize == FPA_BENCH_MAX_BULK && msgLost >= singleMsgLost &&
+            singleMsgLost != 0)
+        {
+            pass = false;
+        }
+    }
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,180 @@
+/*
+ *  Copyright (C) 2016. Marvell International Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+/*
+********************************************************************************
+* fpaFastFailoverTest.c
+*
+* DESCRIPTION:
+*       Fast failover group test, using the port event simulation path.
+*
+*       Usage: fpaFastFailoverTest switchId groupId port0 port1
+*
+*       groupId is a FPA_GROUP_FF group with at least two buckets, and port0
+*       and port1 have link up. The test watches port0 by bucket 0 and port1
+*       by bucket 1, then simulates link down and up by
+*       fpaLibPortEventSimulate and checks the active bucket after each event.
+*       Acceptance: the active bucket follows the link state, and every
+*       failover is done by the library within FPA_TEST_MAX_REACTION_USEC.
+*
+* FILE REVISION NUMBER:
+*       $Revision: 01 $
+*
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "fpaLibApisExt.h"
+
+#define FPA_TEST_MAX_REACTION_USEC  1000
+
+static uint64_t fpaTestTimeUsecGet(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000 + (uint64_t)ts.tv_nsec / 1000;
+}
+
+/* simulate a link state change and check the group reaction */
+static bool fpaTestLinkSet
+(
+    IN   uint32_t  switchId,
+    IN   uint32_t  groupId,
+    IN   uint32_t  portNum,
+    IN   bool      linkUp,
+    IN   uint32_t  expActiveBucket
+)
+{
+    FPA_PORT_EVENT_STC       event;
+    FPA_GROUP_FF_STATUS_STC  before, after;
+    uint64_t                 start, elapsed;
+    FPA_STATUS               rc;
+    bool                     pass = true;
+
+    rc = fpaLibGroupFastFailoverStatusGet(switchId, groupId, &before);
+    if (rc != FPA_OK)
+    {
+        printf("fpaLibGroupFastFailoverStatusGet failed, rc %ld\n", (long)rc);
+        return false;
+    }
+
+    event.eventMask = FPA_EVENT_PORT_STATE;
+    event.portNum   = portNum;
+    event.state     = linkUp ? FPA_PORT_STATE_LIVE : FPA_PORT_STATE_LINK_DOWN;
+
+    start = fpaTestTimeUsecGet();
+    rc = fpaLibPortEventSimulate(switchId, &event);
+    elapsed = fpaTestTimeUsecGet() - start;
+    if (rc != FPA_OK)
+    {
+        printf("fpaLibPortEventSimulate failed, rc %ld\n", (long)rc);
+        return false;
+    }
+
+    rc = fpaLibGroupFastFailoverStatusGet(switchId, groupId, &after);
+    if (rc != FPA_OK)
+    {
+        printf("fpaLibGroupFastFailoverStatusGet failed, rc %ld\n", (long)rc);
+        return false;
+    }
+
+    printf("port %u link %-4s: active bucket %d, failovers %u, "
+           "reaction %u usec, simulate call %llu usec\n",
+           portNum, linkUp ? "up" : "down", (int)after.activeBucketIndex,
+           after.failoverCount, after.lastReactionUsec,
+           (unsigned long long)elapsed);
+
+    if (after.activeBucketIndex != expActiveBucket)
+    {
+        printf("  expected active bucket %d\n", (int)expActiveBucket);
+        pass = false;
+    }
+    if (before.activeBucketIndex != after.activeBucketIndex)
+    {
+        if (after.failoverCount != before.failoverCount + 1)
+        {
+            printf("  expected failover count %u\n", before.failoverCount + 1);
+            pass = false;
+        }
+        if (after.lastReactionUsec > FPA_TEST_MAX_REACTION_USEC)
+        {
+            printf("  reaction above %u usec\n", FPA_TEST_MAX_REACTION_USEC);
+            pass = false;
+        }
+    }
+
+    return pass;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t    switchId, groupId, port0, port1;
+    FPA_GROUP_FF_STATUS_STC status;
+    bool        pass = true;
+    FPA_STATUS  rc;
+
+    if (argc < 5)
+    {
+        fprintf(stderr, "usage: %s switchId groupId port0 port1\n", argv[0]);
+        return 1;
+    }
+    switchId = (uint32_t)strtoul(argv[1], NULL, 0);
+    groupId  = (uint32_t)strtoul(argv[2], NULL, 0);
+    port0    = (uint32_t)strtoul(argv[3], NULL, 0);
+    port1    = (uint32_t)strtoul(argv[4], NULL, 0);
+
+    rc = fpaLibInit();
+    if (rc != FPA_OK)
+    {
+        fprintf(stderr, "fpaLibInit failed, rc %ld\n", (long)rc);
+        return 1;
+    }
+
+    rc = fpaLibGroupEntryBucketWatchSet(switchId, groupId, 0, port0,
+                                        FPA_FLOW_INVALID_VAL);
+    if (rc == FPA_OK)
+    {
+        rc = fpaLibGroupEntryBucketWatchSet(switchId, groupId, 1, port1,
+                                            FPA_FLOW_INVALID_VAL);
+    }
+    if (rc == FPA_OK)
+    {
+        rc = fpaLibGroupFastFailoverStatusGet(switchId, groupId, &status);
+    }
+    if (rc != FPA_OK)
+    {
+        fprintf(stderr, "group 0x%x setup failed, rc %ld\n", groupId, (long)rc);
+        return 1;
+    }
+    if (status.activeBucketIndex != 0)
+    {
+        fprintf(stderr, "group 0x%x: bucket 0 not active, check port %u link\n",
+                groupId, port0);
+        return 1;
+    }
+
+    pass &= fpaTestLinkSet(switchId, groupId, port0, false, 1);
+    pass &= fpaTestLinkSet(switchId, groupId, port1, false,
+                           FPA_FLOW_INVALID_VAL);
+    pass &= fpaTestLinkSet(switchId, groupId, port1, true, 1);
+    pass &= fpaTestLinkSet(switchId, groupId, port0, true, 0);
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
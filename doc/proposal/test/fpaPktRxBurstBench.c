@@ -0,0 +1,140 @@
+/*
+ *  Copyright (C) 2016. Marvell International Ltd. ALL RIGHTS RESERVED.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License"); you may
+ *    not use this file except in compliance with the License. You may obtain
+ *    a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    THIS CODE IS PROVIDED ON AN  *AS IS* BASIS, WITHOUT WARRANTIES OR
+ *    CONDITIONS OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING WITHOUT
+ *    LIMITATION ANY IMPLIED WARRANTIES OR CONDITIONS OF TITLE, FITNESS
+ *    FOR A PARTICULAR PURPOSE, MERCHANTABLITY OR NON-INFRINGEMENT.
+ *
+ *    See the Apache Version 2.0 License for specific language governing
+ *    permissions and limitations under the License.
+ *
+ */
+/*
+********************************************************************************
+* fpaPktRxBurstBench.c
+*
+* DESCRIPTION:
+*       Packet-in microbenchmark: packets/sec of fpaLibPktReceive versus
+*       fpaLibPktReceiveBurst for burst sizes 1 to FPA_BENCH_MAX_BURST.
+*
+*       Usage: fpaPktRxBurstBench [switchId] [seconds]
+*
+*       Packets are trapped to the CPU by the switch configuration, from a
+*       traffic generator sending above the CPU rate during the whole run.
+*       Acceptance: packets/sec grows with the burst size, and every burst
+*       size above 1 beats fpaLibPktReceive.
+*
+* FILE REVISION NUMBER:
+*       $Revision: 01 $
+*
+*******************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "fpaLibApisExt.h"
+
+#define FPA_BENCH_MAX_BURST     256
+#define FPA_BENCH_RX_TIMEOUT    10
+
+static FPA_PACKET_BUFFER_STC pktArray[FPA_BENCH_MAX_BURST];
+
+static double fpaBenchTimeGet(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+/* burstSize 0 - fpaLibPktReceive */
+static FPA_STATUS fpaBenchRun
+(
+    IN   uint32_t  switchId,
+    IN   uint32_t  burstSize,
+    IN   double    seconds,
+    OUT  double    *ppsPtr
+)
+{
+    FPA_STATUS  rc;
+    uint64_t    numOfPkts = 0;
+    uint32_t    numOfBurstPkts;
+    double      start, now;
+
+    start = now = fpaBenchTimeGet();
+    while (now - start < seconds)
+    {
+        if (burstSize == 0)
+        {
+            rc = fpaLibPktReceive(switchId, FPA_BENCH_RX_TIMEOUT, &pktArray[0]);
+            numOfBurstPkts = 1;
+        }
+        else
+        {
+            rc = fpaLibPktReceiveBurst(switchId, FPA_BENCH_RX_TIMEOUT,
+                                       burstSize, pktArray, &numOfBurstPkts);
+        }
+        if (rc == FPA_OK)
+        {
+            numOfPkts += numOfBurstPkts;
+        }
+        else if (rc != FPA_NO_MORE)
+        {
+            return rc;
+        }
+        now = fpaBenchTimeGet();
+    }
+
+    *ppsPtr = (double)numOfPkts / (now - start);
+    return FPA_OK;
+}
+
+int main(int argc, char *argv[])
+{
+    uint32_t    switchId = (argc > 1) ? (uint32_t)strtoul(argv[1], NULL, 0) : 0;
+    double      seconds = (argc > 2) ? strtod(argv[2], NULL) : 10.0;
+    uint32_t    burstSize;
+    double      pps, singlePps;
+    bool        pass = true;
+    FPA_STATUS  rc;
+
+    rc = fpaLibInit();
+    if (rc != FPA_OK)
+    {
+        fprintf(stderr, "fpaLibInit failed, rc %ld\n", (long)rc);
+        return 1;
+    }
+
+    rc = fpaBenchRun(switchId, 0, seconds, &singlePps);
+    if (rc != FPA_OK)
+    {
+        fprintf(stderr, "fpaLibPktReceive failed, rc %ld\n", (long)rc);
+        return 1;
+    }
+    printf("%-24s %12.0f pps\n", "fpaLibPktReceive", singlePps);
+
+    for (burstSize = 1; burstSize <= FPA_BENCH_MAX_BURST; burstSize *= 2)
+    {
+        rc = fpaBenchRun(switchId, burstSize, seconds, &pps);
+        if (rc != FPA_OK)
+        {
+            fprintf(stderr, "fpaLibPktReceiveBurst failed, rc %ld\n", (long)rc);
+            return 1;
+        }
+        printf("burst %-18u %12.0f pps  x%.2f\n", burstSize, pps,
+               pps / singlePps);
+        if (burstSize > 1 && pps <= singlePps)
+        {
+            pass = false;
+        }
+    }
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}